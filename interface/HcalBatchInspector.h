@@ -0,0 +1,204 @@
+#ifndef HcalBatchInspector_h
+#define HcalBatchInspector_h
+
+#include <string>
+#include <vector>
+#include <deque>
+
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+//running summary, plot and value extraction of many payloads in parallel
+namespace HcalObjRepresent{
+
+	// Fixed number of workers, each with its own task queue. A worker takes newest task from
+	// the back of its own queue and, when that is empty, steals oldest task from the front of
+	// another queue, so long plots on one worker do not hold back the rest of the batch.
+	class WorkStealingPool
+	{
+	public:
+		typedef boost::function<void ()> Task;
+
+		explicit WorkStealingPool(unsigned int nThreads)
+			:m_next(0), m_queued(0), m_stop(false){
+			if (nThreads == 0)
+				nThreads = 1;
+			for (unsigned int i = 0; i < nThreads; ++i)
+				m_queues.push_back(new Queue());
+			for (unsigned int i = 0; i < nThreads; ++i)
+				m_threads.create_thread(boost::bind(&WorkStealingPool::work, this, i));
+		}
+
+		// lets workers finish all submitted tasks, then joins them
+		~WorkStealingPool(){
+			{
+				boost::mutex::scoped_lock lock(m_mutex);
+				m_stop = true;
+			}
+			m_wakeup.notify_all();
+			m_threads.join_all();
+			for (unsigned int i = 0; i < m_queues.size(); ++i)
+				delete m_queues[i];
+		}
+
+		unsigned int size() const {return m_queues.size();}
+
+		// Task must not throw; queues are filled round robin.
+		// Callers wait for their own tasks, the pool is shared (see BatchInspector::run()).
+		void submit(Task const & task){
+			{
+				boost::mutex::scoped_lock lock(m_mutex);
+				unsigned int i = m_next;
+				m_next = (m_next + 1) % m_queues.size();
+				//counted together with the push, a worker can not take the task before
+				{
+					boost::mutex::scoped_lock queueLock(m_queues[i]->mutex);
+					m_queues[i]->tasks.push_back(task);
+				}
+				++m_queued;
+			}
+			m_wakeup.notify_one();
+		}
+
+	private:
+		struct Queue
+		{
+			boost::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		std::vector<Queue*> m_queues;
+		boost::thread_group m_threads;
+
+		boost::mutex m_mutex;
+		boost::condition_variable m_wakeup;
+		unsigned int m_next, m_queued;
+		bool m_stop;
+
+		WorkStealingPool(WorkStealingPool const &);
+		WorkStealingPool & operator=(WorkStealingPool const &);
+
+		// own queue first (back), then the other ones (front)
+		bool take(unsigned int self, Task &task){
+			for (unsigned int n = 0; n < m_queues.size(); ++n){
+				unsigned int i = (self + n) % m_queues.size();
+				boost::mutex::scoped_lock lock(m_queues[i]->mutex);
+				std::deque<Task> &tasks = m_queues[i]->tasks;
+				if (tasks.empty())
+					continue;
+				if (n == 0){
+					task = tasks.back();
+					tasks.pop_back();
+				}
+				else{
+					task = tasks.front();
+					tasks.pop_front();
+				}
+				return true;
+			}
+			return false;
+		}
+
+		void work(unsigned int self){
+			Task task;
+			for (;;){
+				if (take(self, task)){
+					{
+						boost::mutex::scoped_lock lock(m_mutex);
+						--m_queued;
+					}
+					task();
+					task.clear();
+					continue;
+				}
+
+				boost::mutex::scoped_lock lock(m_mutex);
+				while (m_queued == 0 && !m_stop)
+					m_wakeup.wait(lock);
+				if (m_queued == 0 && m_stop)
+					return;
+			}
+		}
+	};
+
+	// Pool shared by all inspectors of the process, one worker per core; started on first use.
+	WorkStealingPool & inspectorPool();
+
+	// List of (record, job) pairs, where job is summary, plot or extraction of one payload.
+	// run() executes them on the pool and returns results in order of add(); it waits only for
+	// its own jobs, so batches and Futures of other threads may share the pool.
+	// Payloads are only read, jobs of the same payload may run at the same time.
+	class BatchInspector
+	{
+	public:
+		typedef boost::function<std::string ()> Job;
+
+		struct Result
+		{
+			std::string record;
+			std::string output;
+			//empty if job succeeded
+			std::string error;
+			//MemoryReport of the job, empty unless in bounded-memory mode
+			std::string memory;
+		};
+
+		// Runs job in a BoundedMemoryScope of the calling thread, exceptions become result.error.
+		static void execute(Job const & job, Result &result);
+
+		explicit BatchInspector(WorkStealingPool &pool = inspectorPool()):m_pool(pool), m_remaining(0){}
+
+		void add(std::string const & record, Job const & job){
+			m_records.push_back(record);
+			m_jobs.push_back(job);
+		}
+
+		unsigned int size() const {return m_jobs.size();}
+
+		std::vector<Result> run(){
+			m_results.assign(m_jobs.size(), Result());
+			m_remaining = m_jobs.size();
+			for (unsigned int i = 0; i < m_jobs.size(); ++i){
+				m_results[i].record = m_records[i];
+				m_pool.submit(boost::bind(&BatchInspector::runJob, this, i));
+			}
+			{
+				boost::mutex::scoped_lock lock(m_mutex);
+				while (m_remaining != 0)
+					m_finished.wait(lock);
+			}
+
+			std::vector<Result> results;
+			results.swap(m_results);
+			m_records.clear();
+			m_jobs.clear();
+			return results;
+		}
+
+	private:
+		WorkStealingPool &m_pool;
+		std::vector<std::string> m_records;
+		std::vector<Job> m_jobs;
+		std::vector<Result> m_results;
+
+		//jobs of this batch not finished yet
+		boost::mutex m_mutex;
+		boost::condition_variable m_finished;
+		unsigned int m_remaining;
+
+		BatchInspector(BatchInspector const &);
+		BatchInspector & operator=(BatchInspector const &);
+
+		//every job writes only its own result
+		void runJob(unsigned int i){
+			execute(m_jobs[i], m_results[i]);
+			boost::mutex::scoped_lock lock(m_mutex);
+			if (--m_remaining == 0)
+				m_finished.notify_all();
+		}
+	};
+}
+#endif
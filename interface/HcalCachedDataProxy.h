@@ -0,0 +1,123 @@
+#ifndef HcalCachedDataProxy_h
+#define HcalCachedDataProxy_h
+
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/bind.hpp>
+#include <boost/ref.hpp>
+
+#include "FWCore/Framework/interface/DataProxyTemplate.h"
+#include "FWCore/Framework/interface/DataKey.h"
+#include "FWCore/PluginManager/interface/PluginFactory.h"
+#include "CondCore/DBCommon/interface/DbSession.h"
+#include "CondCore/DBCommon/interface/Exception.h"
+#include "CondCore/IOVService/interface/PayloadProxy.h"
+#include "CondCore/ESSources/interface/ProxyFactory.h"
+
+#include "CondCore/HcalPlugins/interface/HcalPayloadCache.h"
+
+// Same as cond::DataProxyWrapper of CondCore/ESSources, but payloads are taken from
+// PayloadCache<DataT>: an IOV whose token was loaded before (by any proxy of the type)
+// gets the same object without reading and deserializing it again.
+namespace HcalObjRepresent{
+
+	// one cache per payload type, named as in the EventSetup
+	template<class DataT>
+	PayloadCache<DataT> & payloadCache(){
+		static PayloadCache<DataT> cache(edm::eventsetup::DataKey::makeTypeTag<DataT>().name());
+		return cache;
+	}
+
+	template<class DataT>
+	boost::shared_ptr<DataT> readPayload(cond::DbSession & session, std::string const & token){
+		return session.getTypedObject<DataT>(token);
+	}
+
+	template<class DataT>
+	class CachedPayloadProxy: public cond::BasePayloadProxy
+	{
+	public:
+		CachedPayloadProxy(cond::DbSession & session, std::string const & token, bool errorPolicy)
+			:cond::BasePayloadProxy(session, token, errorPolicy), m_cache(payloadCache<DataT>()){}
+
+		DataT const & operator()() const {
+			if (!m_data)
+				throw cond::Exception("CachedPayloadProxy: Data not available");
+			return *m_data;
+		}
+
+		virtual void invalidateCache(){
+			m_data.reset();
+		}
+
+	private:
+		PayloadCache<DataT> &m_cache;
+		typename PayloadCache<DataT>::Payload m_data;
+
+		virtual bool load(cond::DbSession & session, std::string const & token){
+			m_data = m_cache.get(token, boost::bind(&readPayload<DataT>, boost::ref(session), token));
+			return m_data.get();
+		}
+	};
+
+	template<class RecordT, class DataT>
+	class CachedDataProxy: public edm::eventsetup::DataProxyTemplate<RecordT, DataT>
+	{
+	public:
+		explicit CachedDataProxy(boost::shared_ptr<CachedPayloadProxy<DataT> > data):m_data(data){}
+
+	protected:
+		virtual DataT const * make(RecordT const &, edm::eventsetup::DataKey const &){
+			m_data->make();
+			return &(*m_data)();
+		}
+
+		// keep payload for the next IOV, the cache decides when it goes away
+		virtual void invalidateCache(){}
+
+	private:
+		boost::shared_ptr<CachedPayloadProxy<DataT> > m_data;
+	};
+
+	template<class RecordT, class DataT>
+	class CachedDataProxyWrapper: public cond::DataProxyWrapperBase
+	{
+	public:
+		// source picks a PayloadProxy specialization there; cached payloads are always DataT
+		CachedDataProxyWrapper(cond::DbSession & session, std::string const & token, std::string const & il,
+			char const * = 0)
+			:cond::DataProxyWrapperBase(il),
+			m_proxy(new CachedPayloadProxy<DataT>(session, token, true)),
+			m_edmProxy(new CachedDataProxy<RecordT, DataT>(m_proxy)){
+			m_type = edm::eventsetup::DataKey::makeTypeTag<DataT>();
+		}
+
+		// late initialize, as made by the ProxyFactory (to allow to load ALL libraries first)
+		explicit CachedDataProxyWrapper(char const * = 0){
+			m_type = edm::eventsetup::DataKey::makeTypeTag<DataT>();
+		}
+
+		virtual void lateInit(cond::DbSession & session, std::string const & iovtoken,
+			std::string const & il, std::string const & cs, std::string const & tag){
+			m_proxy.reset(new CachedPayloadProxy<DataT>(session, iovtoken, false));
+			m_edmProxy.reset(new CachedDataProxy<RecordT, DataT>(m_proxy));
+			addInfo(il, cs, tag);
+		}
+
+		virtual edm::eventsetup::TypeTag type() const {return m_type;}
+		virtual ProxyP proxy() const {return m_proxy;}
+		virtual edmProxyP edmProxy() const {return m_edmProxy;}
+
+	private:
+		edm::eventsetup::TypeTag m_type;
+		boost::shared_ptr<CachedPayloadProxy<DataT> > m_proxy;
+		edmProxyP m_edmProxy;
+	};
+}
+
+// Used instead of REGISTER_PLUGIN (registration_macros.h), under the same plugin name.
+#define REGISTER_CACHED_PLUGIN(record_, type_) \
+	typedef HcalObjRepresent::CachedDataProxyWrapper< record_, type_ > EDM_PLUGIN_SYM(HcalCachedProxy, __LINE__); \
+	DEFINE_EDM_PLUGIN(cond::ProxyFactory, EDM_PLUGIN_SYM(HcalCachedProxy, __LINE__), #record_ "@NewProxy")
+#endif
@@ -0,0 +1,372 @@
+#ifndef HcalCellGeometry_h
+#define HcalCellGeometry_h
+
+#include <string>
+#include <vector>
+#include <stdlib.h>
+
+#include "DataFormats/HcalDetId/interface/HcalSubdetector.h"
+
+//eta-phi binning of depth plots and validity of HCAL cells, without ROOT
+namespace HcalObjRepresent{
+	// Now define functions that can be used in conjunction with EtaPhi histograms
+
+	// This arrays the eta binning for depth 2 histograms (with a gap between -15 -> +15)
+	extern const int binmapd2[57];
+
+	// This stores eta binning in depth 3 (where HE is only present at a few ieta values)
+
+	extern const int binmapd3[9];
+
+	inline int CalcEtaBin(int subdet, int ieta, int depth)
+	{
+		// This takes the eta value from a subdetector and return an eta counter value as used by eta-phi array
+		// (ieta=-41 corresponds to bin 0, +41 to bin 85 -- there are two offsets to deal with the overlap at |ieta|=29).
+		// For HO, ieta = -15 corresponds to bin 0, and ieta=15 is bin 30
+		// For HE depth 3, things are more complicated, but feeding the ieta value will give back the corresponding counter eta value
+
+		// The CalcEtaBin value is the value as used within our array counters, and thus starts at 0.
+		// If you are using it with getBinContent or setBinContent, you will need to add +1 to the result of this function
+
+		int etabin=-9999; // default invalid value
+
+		if (depth==1)
+		{
+			// Depth 1 is fairly straightforward -- just shift HF-, HF+ by -/+1
+			etabin=ieta+42;
+			if (subdet==HcalForward)
+			{
+				ieta < 0 ? etabin-- : etabin++;
+			}
+		}
+
+		else if (depth==2)
+		{
+			// Depth 2 is more complicated, given that there are no cells in the range |ieta|<15
+			if (ieta<-14)
+			{
+				etabin=ieta+42;
+				if (subdet==HcalForward) etabin--;
+			}
+			else if (ieta>14)
+			{
+				etabin=ieta+14;
+				if (subdet==HcalForward) etabin++;
+			}
+
+		}
+		// HO is also straightforward; a simple offset to the ieta value is applied
+		else if (subdet==HcalOuter && abs(ieta)<16)
+			etabin=ieta+15;
+		else if (subdet==HcalEndcap)
+		{
+			// HE depth 3 has spotty coverage; hard-code the bin response
+			if (depth==3)
+			{
+				if (ieta==-28) etabin=0;
+				else if (ieta==-27) etabin=1;
+				else if (ieta==-16) etabin=3;
+				else if (ieta==16)  etabin=5;
+				else if (ieta==27)  etabin=7;
+				else if (ieta==28)  etabin=8;
+			}
+		}
+		return etabin;
+	}
+
+	inline int CalcIeta(int subdet, int eta, int depth)
+	{
+		// This function returns the 'true' ieta value given subdet, eta, and depth
+		// Here 'eta' is the index from our arrays (it starts at 0);
+		// remember that histogram bins start with bin 1, so there's an offset of 1
+		// to consider if using getBinContent(eta,phi)
+
+		// eta runs from 0...X  (X depends on depth)
+		int ieta=-9999; // default value is nonsensical
+		if (subdet==HcalBarrel)
+		{
+			if (depth==1) 
+			{
+				ieta=eta-42;
+				if (ieta==0) return -9999;
+				return ieta;
+			}
+			else if (depth==2)
+			{
+				ieta=binmapd2[eta];
+				if (ieta==0) return -9999;
+				if (ieta==17 || ieta == -17) 
+					return -9999; // no depth 2 cells at |ieta| = 17
+				return ieta;
+			}
+			else
+				return -9999; // non-physical value
+		}
+		else if (subdet==HcalForward)
+		{
+			if (depth==1)
+			{
+				ieta=eta-42;
+				if (eta<13) ieta++;
+				else if (eta>71) ieta--;
+				else return -9999; // if outside forward range, return dummy
+				return ieta;
+			}
+			else if (depth==2)
+			{
+				ieta=binmapd2[eta]; // special map for depth 2
+				if (ieta<=-30) ieta++;
+				else if (ieta>=30) ieta--;
+				else return -9999;
+				return ieta;
+			}
+			else return -9999;
+		}
+
+		else if (subdet==HcalEndcap)
+		{
+			if (depth==1) 
+				ieta=eta-42;
+			else if (depth==2) 
+			{
+				ieta=binmapd2[eta];
+				if (abs(ieta)>29 || abs(ieta)<18) return -9999; // outside HE
+				if (ieta==0) return -9999;
+				return ieta;
+			}
+			else if (depth==3)
+			{
+				if (eta<0 || eta>8) return -9999;
+				else
+					ieta=binmapd3[eta]; // special map for depth 3
+				if (ieta==0) return -9999;
+				return ieta;
+			}
+			else return -9999;
+		} // HcalEndcap
+		else if ( subdet==HcalOuter)
+		{
+			if (depth!=4)
+				return -9999;
+			else
+			{
+				ieta= eta-15;  // bin 0 is ieta=-15, all bins increment normally from there
+				if (abs(ieta)>15) return -9999;
+				if (ieta==0) return -9999;
+				return ieta;
+			}
+		} // HcalOuter
+		if (ieta==0) return -9999;
+		return ieta;
+	}
+
+	inline int CalcIeta(int eta, int depth)
+	{
+		// This version of CalcIeta does the same as the function above,
+		// but does not require that 'subdet' be specified.
+
+		// returns ieta value give an eta counter.
+		// eta runs from 0...X  (X depends on depth)
+		int ieta=-9999;
+		if (eta<0) return ieta;
+		if (depth==1)
+		{
+			ieta=eta-42; // default shift: bin 0 corresponds to a histogram ieta of -42 (which is offset by 1 from true HF value of -41)
+			if (eta<13) ieta++;
+			else if (eta>71) ieta--;
+			if (ieta==0) ieta=-9999;
+			return ieta;
+		}
+		else if (depth==2)
+		{
+			if (eta>57) return -9999;
+			else
+			{
+				ieta=binmapd2[eta];
+				if (ieta==-9999) return ieta;
+				if (ieta==0) return -9999;
+				if (ieta==17 || ieta == -17) return -9999; // no depth 2 cells at |ieta| = 17
+				else if (ieta<=-30) ieta++;
+				else if (ieta>=30) ieta--;
+				return ieta;
+			}
+		}
+		else if (depth==3)
+		{
+			if (eta>8) return -9999;
+			else
+				ieta=binmapd3[eta];
+			if (ieta==0) return -9999;
+			return ieta;
+		}
+		else if (depth==4)
+		{
+			ieta= eta-15;  // bin 0 is ieta=-15, all bins increment normally from there
+			if (abs(ieta)>15) return -9999;
+			if (ieta==0) return -9999;
+			return ieta;
+		}
+		return ieta; // avoids compilation warning
+	}
+
+
+	// Functions to check whether a given (eta,depth) value is valid for a given subdetector
+
+	inline std::vector<std::string> HcalEtaPhiHistNames()
+	{
+		std::vector<std::string> name;
+		name.push_back("HB HE HF Depth 1 ");
+		name.push_back("HB HE HF Depth 2 ");
+		name.push_back("HE Depth 3 ");
+		name.push_back("HO Depth 4 ");
+		return name;
+	}
+
+
+	inline bool isHB(int etabin, int depth)
+	{
+		if (depth>2) return false;
+		else if (depth<1) return false;
+		else
+		{
+			int ieta=CalcIeta(etabin,depth);
+			if (ieta==-9999) return false;
+			if (depth==1)
+			{
+				if (abs(ieta)<=16 ) return true;
+				else return false;
+			}
+			else if (depth==2)
+			{
+				if (abs(ieta)==15 || abs(ieta)==16) return true;
+				else return false;
+			}
+		}
+		return false;
+	}
+
+	inline bool isHE(int etabin, int depth)
+	{
+		if (depth>3) return false;
+		else if (depth<1) return false;
+		else
+		{
+			int ieta=CalcIeta(etabin,depth);
+			if (ieta==-9999) return false;
+			if (depth==1)
+			{
+				if (abs(ieta)>=17 && abs(ieta)<=28 ) return true;
+				if (ieta==-29 && etabin==13) return true; // HE -29
+				if (ieta==29 && etabin == 71) return true; // HE +29
+			}
+			else if (depth==2)
+			{
+				if (abs(ieta)>=17 && abs(ieta)<=28 ) return true;
+				if (ieta==-29 && etabin==13) return true; // HE -29
+				if (ieta==29 && etabin == 43) return true; // HE +29
+			}
+			else if (depth==3)
+				return true;
+		}
+		return false;
+	}
+
+	inline bool isHF(int etabin, int depth)
+	{
+		if (depth>2) return false;
+		else if (depth<1) return false;
+		else
+		{
+			int ieta=CalcIeta(etabin,depth);
+			if (ieta==-9999) return false;
+			if (depth==1)
+			{
+				if (ieta==-29 && etabin==13) return false; // HE -29
+				else if (ieta==29 && etabin == 71) return false; // HE +29
+				else if (abs(ieta)>=29 ) return true;
+			}
+			else if (depth==2)
+			{
+				if (ieta==-29 && etabin==13) return false; // HE -29
+				else if (ieta==29 && etabin==43) return false; // HE +29
+				else if (abs(ieta)>=29 ) return true;
+			}
+		}
+		return false;
+	}
+
+	inline bool isHO(int etabin, int depth)
+	{
+		if (depth!=4) return false;
+		int ieta=CalcIeta(etabin,depth);
+		if (ieta!=-9999) return true;
+		return false;
+	}
+
+	// Checks whether HO region contains SiPM
+
+	inline bool isSiPM(int ieta, int iphi, int depth)
+	{
+		if (depth!=4) return false;
+		// HOP1
+		if (ieta>=5 && ieta <=10 && iphi>=47 && iphi<=58) return true;  
+		// HOP2
+		if (ieta>=11 && ieta<=15 && iphi>=59 && iphi<=70) return true;
+		return false;
+	}  // bool isSiPM
+
+
+	// Checks whether (subdet, ieta, iphi, depth) value is a valid Hcal cell
+
+	inline bool validDetId(HcalSubdetector sd, int ies, int ip, int dp)
+	{
+		// inputs are (subdetector, ieta, iphi, depth)
+		// stolen from latest version of DataFormats/HcalDetId/src/HcalDetId.cc (not yet available in CMSSW_2_1_9)
+
+		const int ie ( abs( ies ) ) ;
+
+		return ( ( ip >=  1         ) &&
+			( ip <= 72         ) &&
+			( dp >=  1         ) &&
+			( ie >=  1         ) &&
+			( ( ( sd == HcalBarrel ) &&
+			( ( ( ie <= 14         ) &&
+			( dp ==  1         )    ) ||
+			( ( ( ie == 15 ) || ( ie == 16 ) ) && 
+			( dp <= 2          )                ) ) ) ||
+			(  ( sd == HcalEndcap ) &&
+			( ( ( ie == 16 ) &&
+			( dp ==  3 )          ) ||
+			( ( ie == 17 ) &&
+			( dp ==  1 )          ) ||
+			( ( ie >= 18 ) &&
+			( ie <= 20 ) &&
+			( dp <=  2 )          ) ||
+			( ( ie >= 21 ) &&
+			( ie <= 26 ) &&
+			( dp <=  2 ) &&
+			( ip%2 == 1 )         ) ||
+			( ( ie >= 27 ) &&
+			( ie <= 28 ) &&
+			( dp <=  3 ) &&
+			( ip%2 == 1 )         ) ||
+			( ( ie == 29 ) &&
+			( dp <=  2 ) &&
+			( ip%2 == 1 )         )          )      ) ||
+			(  ( sd == HcalOuter ) &&
+			( ie <= 15 ) &&
+			( dp ==  4 )           ) ||
+			(  ( sd == HcalForward ) &&
+			( dp <=  2 )          &&
+			( ( ( ie >= 29 ) &&
+			( ie <= 39 ) &&
+			( ip%2 == 1 )    ) ||
+			( ( ie >= 40 ) &&
+			( ie <= 41 ) &&
+			( ip%4 == 3 )         )  ) ) ) ) ;
+
+
+
+	} // bool validDetId(HcalSubdetector sd, int ies, int ip, int dp)
+}
+#endif
@@ -0,0 +1,67 @@
+#ifndef HcalChannelIndex_h
+#define HcalChannelIndex_h
+
+#include <vector>
+
+#include "DataFormats/DetId/interface/DetId.h"
+#include "DataFormats/HcalDetId/interface/HcalDetId.h"
+#include "DataFormats/HcalDetId/interface/HcalSubdetector.h"
+
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
+
+//dense numbering of all HCAL cells, for array operations over several payloads
+namespace HcalObjRepresent{
+
+	// Every cell accepted by validDetId (HB, HE, HO, HF) gets one slot 0..nChannels-1,
+	// ordered by subdetector, ieta, depth and iphi. A slot is a ring offset (one small table
+	// per subdetector, ieta and depth) plus the position of iphi in the ring, so there are
+	// no collisions and no search. detId() is the inverse.
+	class ChannelIndex
+	{
+	public:
+		// HB 2592, HE 2592, HO 2160, HF 1728
+		static const unsigned int nChannels = 9072;
+
+		// slot of cell, -1 if it is not a valid HB/HE/HO/HF cell
+		static int slot(HcalSubdetector sd, int ieta, int iphi, int depth);
+		static int slot(HcalDetId const & id){return slot(id.subdet(), id.ieta(), id.iphi(), id.depth());}
+		// -1 also for channels of other detectors (ZDC, calibration, CASTOR, trigger towers);
+		// HcalDetId is made only for HB/HE/HO/HF ids, for the others its constructor throws
+		static int slot(DetId id){
+			if (id.det() != DetId::Hcal)
+				return -1;
+			switch(id.subdetId()){
+				case HcalBarrel:
+				case HcalEndcap:
+				case HcalOuter:
+				case HcalForward:
+					return slot(HcalDetId(id));
+				default:
+					return -1;
+			}
+		}
+
+		static HcalDetId detId(unsigned int slot){return detIds()[slot];}
+
+		// all cells, in slot order
+		static std::vector<HcalDetId> const & detIds();
+	};
+
+	// Calls store(slot, item) for every item of payload which is a HB/HE/HO/HF cell,
+	// in one pass over the containers of payload.
+	template<class Payload, class Store>
+	void forEachCell(Payload const & payload, Store &store){
+		ContainerView<Payload> allContainers(payload);
+		typename ContainerView<Payload>::const_iterator iter;
+		typename ContainerView<Payload>::Span::const_iterator contIter;
+
+		for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
+			for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
+				int slot = ChannelIndex::slot(DetId((*contIter).rawId()));
+				if (slot >= 0)
+					store(slot, *contIter);
+			}
+		}
+	}
+}
+#endif
@@ -0,0 +1,81 @@
+#ifndef HcalChannelValues_h
+#define HcalChannelValues_h
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <limits>
+
+#include "DataFormats/DetId/interface/DetId.h"
+
+//values of selected channels of a payload, without going through the whole payload
+namespace HcalObjRepresent{
+
+	// Describes the values stored in one payload item (e.g. HcalMCParam).
+	// Every specialization has to provide:
+	//   static const unsigned int nValues;                      -- how much values are in item
+	//   static float value(Item const & item, unsigned int i);  -- value number i of the item
+	//   static std::string name(unsigned int i);                -- name of value i, used in summary and plot titles
+	// value() and name() are inline, so loops over them compile to the same code as the hand written ones.
+	template<class Item>
+	struct FieldDescriptor;
+
+	// item type stored in payload containers (HcalMCParams -> HcalMCParam)
+	template<class Payload>
+	struct PayloadItem{
+		typedef typename Payload::tAllContWithNames::value_type::second_type::value_type type;
+	};
+
+	// name followed by numbers, e.g. ("Gain", 2) -> "Gain2"
+	inline std::string indexedName(std::string const & name, unsigned int i){
+		std::stringstream ss;
+		ss << name << i;
+		return ss.str();
+	}
+
+	// Lookup of one channel. For HcalCondObjectContainer payloads the item is found by
+	// getValues(), which indexes the containers by hashed channel index, so each lookup is O(1).
+	// Payloads of other shape specialize the whole struct.
+	template<class Payload>
+	struct ChannelLookup{
+		typedef typename PayloadItem<Payload>::type Item;
+		typedef FieldDescriptor<Item> Fields;
+
+		static unsigned int nValues(){return Fields::nValues;}
+		static std::string name(unsigned int i){return Fields::name(i);}
+
+		// writes nValues() values of channel to values, false if payload has no such channel
+		static bool get(Payload const & payload, DetId id, float * values){
+			if (!payload.exists(id))
+				return false;
+			Item const & item = *payload.getValues(id);
+			for (unsigned int i = 0; i < Fields::nValues; ++i)
+				values[i] = Fields::value(item, i);
+			return true;
+		}
+	};
+
+	// Matrix of values of the given channels, row after row: ChannelLookup<Payload>::nValues()
+	// floats per raw id, all NaN for channels which are not in payload.
+	template<class Payload>
+	void channelValues(Payload const & payload, std::vector<int> const & rawIds, std::vector<float> &values){
+		typedef ChannelLookup<Payload> Lookup;
+		unsigned int n = Lookup::nValues();
+		values.assign(rawIds.size() * n, std::numeric_limits<float>::quiet_NaN());
+		if (n == 0)
+			return;
+		for (unsigned int row = 0; row < rawIds.size(); ++row)
+			Lookup::get(payload, DetId((uint32_t)rawIds[row]), &values[row * n]);
+	}
+
+	// names of the columns of channelValues()
+	template<class Payload>
+	std::vector<std::string> valueNames(){
+		typedef ChannelLookup<Payload> Lookup;
+		std::vector<std::string> names;
+		for (unsigned int i = 0; i < Lookup::nValues(); ++i)
+			names.push_back(Lookup::name(i));
+		return names;
+	}
+}
+#endif
@@ -0,0 +1,57 @@
+#ifndef HcalCompositeCalibration_h
+#define HcalCompositeCalibration_h
+
+#include <string>
+#include <vector>
+
+#include "CondFormats/HcalObjects/interface/HcalGains.h"
+#include "CondFormats/HcalObjects/interface/HcalRespCorrs.h"
+#include "CondFormats/HcalObjects/interface/HcalQIEData.h"
+#include "CondFormats/HcalObjects/interface/HcalPFCorrs.h"
+#include "CondFormats/HcalObjects/interface/HcalTimeCorrs.h"
+
+#include "CondCore/HcalPlugins/interface/HcalChannelIndex.h"
+
+//effective calibration of all HCAL cells, joined from several payloads of one run
+namespace HcalObjRepresent{
+
+	// Per cell: gain(capId) x response correction x QIE slope(capId, range 0), for each capId and
+	// averaged, with the inputs and the optional PF and time corrections kept next to it.
+	// Every payload is read in one pass over its containers into arrays indexed by ChannelIndex slot,
+	// composites are then computed element by element. Payloads are not used after construction.
+	class CompositeCalibration
+	{
+	public:
+		enum Column {Composite0, Composite1, Composite2, Composite3, Composite,
+			Gain, RespCorr, QIESlope, PFCorr, TimeCorr, nColumns};
+
+		CompositeCalibration(HcalGains const & gains, HcalRespCorrs const & respCorrs, HcalQIEData const & qie,
+			HcalPFCorrs const * pfCorrs = 0, HcalTimeCorrs const * timeCorrs = 0);
+
+		static std::string columnName(unsigned int column);
+
+		// ChannelIndex::nChannels values of column in slot order; NaN where an input has no such channel
+		std::vector<float> const & column(unsigned int column) const {return m_columns.at(column);}
+
+		// true if gains, response corrections and QIE data all have the cell
+		bool complete(unsigned int slot) const {return m_found[slot] == foundAll;}
+		unsigned int nComplete() const;
+
+		// all columns of the given channels, row after row (as channelValues()), NaN rows for unknown channels
+		void values(std::vector<int> const & rawIds, std::vector<float> &values) const;
+
+		// per subdetector: complete cells, cells missing in each input, average and deviation of every column
+		std::string summary() const;
+
+		// four depth maps of Composite, saved as filename
+		std::string plot(std::string const & filename) const;
+
+	private:
+		// bits of m_found
+		enum Input {FoundGains = 1, FoundRespCorrs = 2, FoundQIE = 4, foundAll = 7};
+
+		std::vector<std::vector<float> > m_columns;
+		std::vector<unsigned char> m_found;
+	};
+}
+#endif
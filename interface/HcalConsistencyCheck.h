@@ -0,0 +1,85 @@
+#ifndef HcalConsistencyCheck_h
+#define HcalConsistencyCheck_h
+
+#include <string>
+#include <vector>
+
+#include "CondFormats/HcalObjects/interface/HcalGains.h"
+#include "CondFormats/HcalObjects/interface/HcalGainWidths.h"
+#include "CondFormats/HcalObjects/interface/HcalPedestals.h"
+#include "CondFormats/HcalObjects/interface/HcalPedestalWidths.h"
+#include "CondFormats/HcalObjects/interface/HcalQIEData.h"
+#include "CondFormats/HcalObjects/interface/HcalChannelQuality.h"
+
+#include "CondCore/HcalPlugins/interface/HcalChannelIndex.h"
+
+//validation of related HCAL payloads against each other
+namespace HcalObjRepresent{
+
+	// Payloads are added one by one (each read once into arrays indexed by ChannelIndex slot),
+	// run() then checks all rules in one pass over the slots. Only rules whose payloads were
+	// added are checked. Payloads are not used after add().
+	class ConsistencyCheck
+	{
+	public:
+		enum Rule {
+			GainNotPositive,            // gain of some capId <= 0
+			GainWidthAboveGain,         // gain width > gain for some capId
+			PedestalWidthAbovePedestal, // pedestal width > pedestal for some capId
+			MissingChannel,             // cell in one of the added payloads but not in another one
+			DeadWithCalibration,        // dead bit (5) in channel quality, gain or QIE slope not default
+			nRules};
+
+		// subdetectors of counts, in ChannelIndex order
+		enum Subdet {HB, HE, HO, HF, nSubdets};
+
+		ConsistencyCheck();
+
+		void add(HcalGains const & gains);
+		void add(HcalGainWidths const & gainWidths);
+		void add(HcalPedestals const & pedestals);
+		void add(HcalPedestalWidths const & pedestalWidths);
+		void add(HcalQIEData const & qie);
+		void add(HcalChannelQuality const & quality);
+
+		// values of calibrations of dead channels, 1 for gain; QIE slopes are compared only if set
+		void setDefaultGain(float gain){m_defaultGain = gain;}
+		void setDefaultQIESlope(float slope){m_defaultSlope = slope;}
+
+		void run();
+
+		static std::string ruleName(unsigned int rule);
+
+		unsigned int count(unsigned int rule, unsigned int subdet) const {return m_counts.at(rule).at(subdet);}
+		// raw ids of cells breaking rule
+		std::vector<int> flagged(unsigned int rule) const;
+
+		// counts per rule and subdetector, cells missing in each payload
+		std::string summary() const;
+
+		// four depth map of number of broken rules per cell, saved as filename
+		std::string plot(std::string const & filename) const;
+
+	private:
+		enum Input {InGains, InGainWidths, InPedestals, InPedestalWidths, InQIE, InQuality, nInputs};
+
+		// 4 values (one per capId) of every slot, per input; status bits of channel quality
+		std::vector<std::vector<float> > m_values;
+		std::vector<uint32_t> m_status;
+		// bit per input: payload added / slot present in payload
+		unsigned int m_added;
+		std::vector<unsigned char> m_present;
+
+		float m_defaultGain, m_defaultSlope;
+
+		// bit per rule for every slot, and counts
+		std::vector<unsigned int> m_flags;
+		std::vector<std::vector<unsigned int> > m_counts;
+
+		static std::string inputName(unsigned int input);
+		bool added(Input input) const {return m_added & (1 << input);}
+		bool present(unsigned int slot, Input input) const {return m_present[slot] & (1 << input);}
+		float value(Input input, unsigned int slot, unsigned int capId) const {return m_values[input][slot * 4 + capId];}
+	};
+}
+#endif
@@ -0,0 +1,106 @@
+#ifndef HcalContainerView_h
+#define HcalContainerView_h
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "DataFormats/DetId/interface/DetId.h"
+#include "DataFormats/HcalDetId/interface/HcalSubdetector.h"
+#include "DataFormats/HcalDetId/interface/HcalZDCDetId.h"
+#include "DataFormats/HcalDetId/interface/HcalCastorDetId.h"
+
+//read-only access to payload containers without copying them
+namespace HcalObjRepresent{
+
+	// Contiguous range of items inside one container of the payload.
+	template<class Item>
+	class ItemSpan
+	{
+	public:
+		typedef const Item * const_iterator;
+
+		ItemSpan():m_begin(0), m_end(0){}
+		ItemSpan(const Item * first, const Item * last):m_begin(first), m_end(last){}
+
+		const_iterator begin() const {return m_begin;}
+		const_iterator end() const {return m_end;}
+		unsigned int size() const {return m_end - m_begin;}
+		bool empty() const {return m_begin == m_end;}
+		Item const & operator[](unsigned int i) const {return m_begin[i];}
+
+	private:
+		const Item * m_begin;
+		const Item * m_end;
+	};
+
+	// containers in order of getAllContainers()
+	const unsigned int nContainers = 8;
+	static const char * const containerNames[nContainers] = {"HB", "HE", "HO", "HF", "HT", "ZDC", "CALIB", "CASTOR"};
+
+	// position of the container of channel in containerNames, nContainers if unknown
+	inline unsigned int containerIndex(DetId id){
+		if (id.det() == DetId::Hcal){
+			switch(id.subdetId()){
+				case HcalBarrel: return 0;
+				case HcalEndcap: return 1;
+				case HcalOuter: return 2;
+				case HcalForward: return 3;
+				case HcalTriggerTower: return 4;
+				case HcalOther: return 6;
+			}
+		}
+		else if (id.det() == DetId::Calo){
+			if (id.subdetId() == HcalZDCDetId::SubdetectorId)
+				return 5;
+			if (id.subdetId() == HcalCastorDetId::SubdetectorId)
+				return 7;
+		}
+		return nContainers;
+	}
+
+	// Same shape as Payload::tAllContWithNames (name, items) but every container is a span
+	// over the vector kept inside the payload, so channel data is never copied.
+	// Spans are found from getValues() of the channels listed by getAllChannels(), and
+	// run from the first to the last filled slot of each container. The payload must outlive the view.
+	template<class Payload>
+	class ContainerView
+	{
+	public:
+		typedef typename Payload::tAllContWithNames::value_type::second_type::value_type Item;
+		typedef ItemSpan<Item> Span;
+		typedef std::pair<std::string, Span> value_type;
+		typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+		explicit ContainerView(Payload const & payload){
+			std::vector<const Item *> first(nContainers, (const Item *)0), last(nContainers, (const Item *)0);
+
+			std::vector<DetId> channels = payload.getAllChannels();
+			for (std::vector<DetId>::const_iterator id = channels.begin(); id != channels.end(); ++id){
+				unsigned int c = containerIndex(*id);
+				if (c == nContainers)
+					continue;
+				const Item * item = payload.getValues(*id);
+				if (!first[c] || item < first[c])
+					first[c] = item;
+				if (!last[c] || item > last[c])
+					last[c] = item;
+			}
+
+			for (unsigned int c = 0; c < nContainers; ++c){
+				if (first[c])
+					m_containers.push_back(value_type(containerNames[c], Span(first[c], last[c] + 1)));
+				else
+					m_containers.push_back(value_type(containerNames[c], Span()));
+			}
+		}
+
+		const_iterator begin() const {return m_containers.begin();}
+		const_iterator end() const {return m_containers.end();}
+		unsigned int size() const {return m_containers.size();}
+
+	private:
+		std::vector<value_type> m_containers;
+	};
+}
+#endif
@@ -0,0 +1,84 @@
+#ifndef HcalCoverage_h
+#define HcalCoverage_h
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "DataFormats/DetId/interface/DetId.h"
+
+#include "CondCore/HcalPlugins/interface/HcalChannelIndex.h"
+
+//which valid HCAL cells a payload has, compared to validDetId
+namespace HcalObjRepresent{
+
+	// One bit per ChannelIndex slot.
+	class CellBitmap
+	{
+	public:
+		static const unsigned int nWords = (ChannelIndex::nChannels + 63) / 64;
+
+		CellBitmap():m_words(nWords, 0){}
+
+		// bitmap of all cells
+		static CellBitmap const & all();
+
+		void set(unsigned int slot){m_words[slot / 64] |= (uint64_t)1 << (slot % 64);}
+		bool test(unsigned int slot) const {return m_words[slot / 64] & ((uint64_t)1 << (slot % 64));}
+		unsigned int count() const;
+
+		// this & ~other
+		CellBitmap minus(CellBitmap const & other) const;
+		// raw ids of set cells, in slot order
+		std::vector<int> rawIds() const;
+
+	private:
+		std::vector<uint64_t> m_words;
+	};
+
+	// Coverage of HB/HE/HO/HF by the channels of one payload: cells accepted by validDetId which
+	// the payload does not have (missing), and HB/HE/HO/HF channels which validDetId rejects (extra).
+	// Channels of other detectors (ZDC, calibration, CASTOR, trigger towers) are not counted.
+	class Coverage
+	{
+	public:
+		Coverage():m_nChannels(0){}
+
+		void add(DetId id);
+
+		unsigned int nChannels() const {return m_nChannels;}
+		unsigned int nCovered() const {return m_present.count();}
+		unsigned int nMissing() const {return CellBitmap::all().minus(m_present).count();}
+		unsigned int nExtra() const {return m_extra.size();}
+
+		std::vector<int> missing() const {return CellBitmap::all().minus(m_present).rawIds();}
+		std::vector<int> extra() const {return m_extra;}
+
+		// counts per subdetector, with the extra channels listed
+		std::string summary() const;
+
+		// four depth maps of missing and of extra cells, saved as filename_Missing.png, filename_Extra.png
+		std::string plot(std::string const & filename) const;
+
+	private:
+		unsigned int m_nChannels;
+		CellBitmap m_present;
+		std::vector<int> m_extra;
+	};
+
+	// Channels of payload, HcalCondObjectContainer by default; payloads of other shape specialize it.
+	template<class Payload>
+	struct PayloadChannels{
+		static std::vector<DetId> get(Payload const & payload){return payload.getAllChannels();}
+	};
+
+	template<class Payload>
+	Coverage coverageOf(Payload const & payload){
+		Coverage coverage;
+		std::vector<DetId> channels = PayloadChannels<Payload>::get(payload);
+		for (std::vector<DetId>::const_iterator id = channels.begin(); id != channels.end(); ++id)
+			coverage.add(*id);
+		return coverage;
+	}
+}
+#endif
@@ -0,0 +1,200 @@
+#ifndef HcalEtaPhiGrid_h
+#define HcalEtaPhiGrid_h
+
+#include <string>
+#include <vector>
+#include "math.h"
+
+#include "CondCore/HcalPlugins/interface/HcalCellGeometry.h"
+
+//fill target for depth plots, without ROOT
+namespace HcalObjRepresent{
+
+	// Mean and RMS of the values of every ieta ring and iphi sector per depth, from the channels
+	// themselves (each channel counted once, unlike the replicated bins of the depth histograms).
+	// Rings are numbered by plotted eta, -42..42, as the x axis of the depth histograms.
+	class EtaPhiProfiles
+	{
+	public:
+		static const int nDepths = 4;
+		static const int nRings = 85;
+		static const int nSectors = 72;
+
+		struct Moments
+		{
+			Moments():n(0), sum(0.0), sqrSum(0.0){}
+			unsigned int n;
+			double sum, sqrSum;
+
+			double mean() const {return n ? sum / n : 0.0;}
+			double rms() const {
+				if (n == 0) return 0.0;
+				double avg = mean();
+				//here needs to take absolute value for sqrt:
+				return sqrt(fabs(sqrSum / n - avg * avg));
+			}
+		};
+
+		// nothing is accumulated until enabled
+		void enable(){
+			m_rings.assign(nDepths * nRings, Moments());
+			m_sectors.assign(nDepths * nSectors, Moments());
+		}
+		bool enabled() const {return !m_rings.empty();}
+
+		void add(int depth, int eta, int iphi, float value){
+			Moments &ring = m_rings[(depth-1) * nRings + eta + 42];
+			Moments &sector = m_sectors[(depth-1) * nSectors + iphi - 1];
+			++ring.n; ring.sum += value; ring.sqrSum += value * value;
+			++sector.n; sector.sum += value; sector.sqrSum += value * value;
+		}
+
+		Moments const & ring(int depth, int eta) const {return m_rings[(depth-1) * nRings + eta + 42];}
+		Moments const & sector(int depth, int iphi) const {return m_sectors[(depth-1) * nSectors + iphi - 1];}
+
+		// ieta of plotted eta, HF (|eta| > 29) is plotted one bin further out
+		static int ieta(int eta){
+			if (eta > 29) return eta - 1;
+			if (eta < -29) return eta + 1;
+			return eta;
+		}
+
+	private:
+		std::vector<Moments> m_rings, m_sectors;
+	};
+
+	// Values filled into a grid, kept per subdetector (HB, HE, HO, HF) for 1D distributions.
+	// Subdetector is found from depth and eta bin of the depth histograms (isHB()... in HcalCellGeometry.h).
+	class SubdetValues
+	{
+	public:
+		enum Subdet {HB, HE, HO, HF, nSubdets};
+
+		// nothing is kept until enabled
+		void enable(){m_values.assign(nSubdets, std::vector<float>());}
+		bool enabled() const {return !m_values.empty();}
+
+		void add(int depth, int etabin, float value){
+			int sd = subdet(depth, etabin);
+			if (sd >= 0)
+				m_values[sd].push_back(value);
+		}
+
+		std::vector<float> const & values(unsigned int subdet) const {return m_values[subdet];}
+
+		static std::string name(unsigned int subdet);
+
+		// Subdet of bin, -1 if there is no cell
+		static int subdet(int depth, int etabin);
+
+	private:
+		std::vector<std::vector<float> > m_values;
+	};
+
+	// One float per bin of the 4 depth histograms made by setup() (same eta binning,
+	// 72 phi bins), stored in one contiguous array: 182 * 72 floats per image set.
+	// Values are summed like TH2F::Fill; conversion to TH2F is done only for images
+	// which are drawn (see gridToDepths in HcalObjRepresent.h).
+	class EtaPhiGrid
+	{
+	public:
+		static const int nDepths = 4;
+		static const int nPhi = 72;
+
+		EtaPhiGrid():m_values(nCells(), 0.0), m_entries(nDepths, 0){}
+
+		// number of eta bins in depth 1-4
+		static int nEta(int depth){
+			static const int n[nDepths] = {85, 57, 9, 31};
+			return (depth < 1 || depth > nDepths) ? 0 : n[depth-1];
+		}
+
+		// Eta bin (from 0) of depth histogram for plotted eta (ieta with HF shifted by one), -1 if outside.
+		static int etaBin(int depth, int eta){
+			switch(depth){
+				case 1:
+					return (eta >= -42 && eta <= 42) ? eta + 42 : -1;
+				case 2:
+					if (eta >= -42 && eta <= -15) return eta + 42;
+					if (eta >= -14 && eta <= 14) return 28;
+					if (eta >= 15 && eta <= 42) return eta + 14;
+					return -1;
+				case 3:
+					if (eta < -28 || eta > 28) return -1;
+					if (eta <= -27) return eta + 28;
+					if (eta <= -17) return 2;
+					if (eta == -16) return 3;
+					if (eta <= 15) return 4;
+					if (eta == 16) return 5;
+					if (eta <= 26) return 6;
+					return eta - 20;
+				case 4:
+					return (eta >= -15 && eta <= 15) ? eta + 15 : -1;
+			}
+			return -1;
+		}
+
+		static int nCells(){
+			return (nEta(1) + nEta(2) + nEta(3) + nEta(4)) * nPhi;
+		}
+
+		// position of (depth, eta bin, phi bin) in values(), all counted from 0
+		static int cell(int depth, int etabin, int phibin){
+			int offset = 0;
+			for (int d = 1; d < depth; ++d)
+				offset += nEta(d) * nPhi;
+			return offset + etabin * nPhi + phibin;
+		}
+
+		// position of (depth, plotted eta, iphi), -1 if it has no bin
+		static int index(int depth, int eta, int iphi){
+			int etabin = etaBin(depth, eta);
+			if (etabin < 0 || iphi < 1 || iphi > nPhi)
+				return -1;
+			return cell(depth, etabin, iphi - 1);
+		}
+
+		// true for bins which hold a valid HB/HE/HO/HF cell (HF 20 degree cells only at their iphi)
+		static std::vector<bool> const & physicalCells();
+
+		void fill(int depth, int eta, int iphi, float value){
+			int i = index(depth, eta, iphi);
+			if (i < 0)
+				return;
+			m_values[i] += value;
+			++m_entries[depth-1];
+			if (m_profiles.enabled())
+				m_profiles.add(depth, eta, iphi, value);
+			if (m_subdetValues.enabled())
+				m_subdetValues.add(depth, etaBin(depth, eta), value);
+		}
+
+		float value(int depth, int etabin, int phibin) const {return m_values[cell(depth, etabin, phibin)];}
+		std::vector<float> const & values() const {return m_values;}
+		unsigned int entries(int depth) const {return m_entries[depth-1];}
+
+		// ring and sector profiles, filled together with the grid once enabled
+		void enableProfiles(){m_profiles.enable();}
+		EtaPhiProfiles const & profiles() const {return m_profiles;}
+
+		// values per subdetector, kept while filling once enabled
+		void enableSubdetValues(){m_subdetValues.enable();}
+		SubdetValues const & subdetValues() const {return m_subdetValues;}
+
+		void reset(){
+			m_values.assign(m_values.size(), 0.0);
+			m_entries.assign(nDepths, 0);
+			if (m_profiles.enabled())
+				m_profiles.enable();
+			if (m_subdetValues.enabled())
+				m_subdetValues.enable();
+		}
+
+	private:
+		std::vector<float> m_values;
+		std::vector<unsigned int> m_entries;
+		EtaPhiProfiles m_profiles;
+		SubdetValues m_subdetValues;
+	};
+}
+#endif
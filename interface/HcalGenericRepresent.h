@@ -0,0 +1,174 @@
+#ifndef HcalGenericRepresent_h
+#define HcalGenericRepresent_h
+
+#include <string>
+#include <sstream>
+#include <vector>
+
+#include "math.h"
+//functions for correct representation of data in summary and plot:
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
+//FieldDescriptor and PayloadItem:
+#include "CondCore/HcalPlugins/interface/HcalChannelValues.h"
+
+//generic summary, plot and value extraction for HCAL payloads, driven by a per-item field descriptor
+namespace HcalObjRepresent{
+
+	template<class Payload>
+	class GenericDataRepr: public ADataRepr
+	{
+	public:
+		typedef typename PayloadItem<Payload>::type Item;
+		typedef FieldDescriptor<Item> Fields;
+
+		GenericDataRepr(ContainerView<Payload> const & allCont)
+			:ADataRepr(Fields::nValues), allContainers(allCont){}
+
+	protected:
+		ContainerView<Payload> allContainers;
+
+		void doFillIn(std::vector<EtaPhiGrid> &grids){
+			//ITERATORS AND VALUES:
+			typename ContainerView<Payload>::const_iterator iter;
+			typename ContainerView<Payload>::Span::const_iterator contIter;
+			float value = 0.0;
+
+			//run trough all pair containers
+			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
+				//Run trough all values:
+				for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
+					if (!setCell((uint32_t)(*contIter).rawId()))
+						continue;
+
+					//GET VALUES (all values of channel are loaded once):
+					for (unsigned int i = 0; i < grids.size(); ++i){
+						value = Fields::value(*contIter, i);
+						grids[i].fill(depth, ieta, iphi, value);
+					}
+				}
+			}
+		}
+	};
+
+	template<class Payload>
+	std::string genericSummary(Payload const & payload){
+		typedef typename PayloadItem<Payload>::type Item;
+		typedef FieldDescriptor<Item> Fields;
+
+		std::stringstream ss;
+		unsigned int totalValues = Fields::nValues;
+		// get all containers with names
+		ContainerView<Payload> allContainers(payload);
+
+		// initializing iterators
+		typename ContainerView<Payload>::const_iterator iter;
+		typename ContainerView<Payload>::Span::const_iterator contIter;
+
+		ss << "Total HCAL containers: " << allContainers.size() << std::endl;
+
+		std::vector<float> sums(totalValues), sqr_sums(totalValues);
+		float sum = 0.0, average = 0.0, std_dev = 0.0, sqr_sum = 0.0;
+		int size = 0;
+
+		//Run trough all 8 detector containers:
+		for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
+			ss << "---------------------------------------------" << std::endl;
+			ss << "Detector: " << (*iter).first << ";    Total values: "<< (*iter).second.size() << std::endl;
+			size = (*iter).second.size();
+			if (size == 0)
+				continue;
+
+			sums.assign(totalValues, 0.0);
+			sqr_sums.assign(totalValues, 0.0);
+			float capValue = 0.0;
+			//Run trough all values in container
+			for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
+				//Run trough all values in object:
+				for (unsigned int i = 0; i < totalValues; ++i){
+					capValue = Fields::value(*contIter, i);
+					sums[i] += capValue;
+					sqr_sums[i] += (capValue * capValue);
+				}
+			}
+
+			for (unsigned int i = 0; i < totalValues; ++i){
+				sum = sums[i];
+				sqr_sum = sqr_sums[i];
+				average = sum/size;
+				//here needs to take absolute value for sqrt:
+				std_dev = sqrt( fabs((sqr_sum / size) - (average * average)) );
+
+				ss  << "    " << Fields::name(i) << " :"<< std::endl;
+				ss	<< "          Average: " << average << "; "<< std::endl;
+				ss	<< "          Standart deviation: " << std_dev << "; " << std::endl;
+			}
+		}
+		return ss.str();
+	}
+
+	template<class Payload>
+	std::string genericPlot(Payload const & payload, std::string const & filename){
+		typedef typename PayloadItem<Payload>::type Item;
+		typedef FieldDescriptor<Item> Fields;
+
+		//how much values are in container
+		unsigned int numOfValues = Fields::nValues;
+
+		//create object helper for making plots;
+		GenericDataRepr<Payload> datarepr((ContainerView<Payload>(payload)));
+
+		datarepr.nr = 0;
+		datarepr.id = 0;
+
+		typedef std::vector<TH2F> graphData;
+		std::vector< graphData > graphDataVec(numOfValues);
+		std::vector< graphData >::iterator imageIter;
+
+		//create images:
+		for (imageIter = graphDataVec.begin(); imageIter != graphDataVec.end(); ++imageIter){
+			std::string name = Fields::name(datarepr.id);
+			datarepr.rootname.str("");
+			datarepr.rootname << "_" << name << "rootvalue_";
+			datarepr.plotname.str("");
+			datarepr.plotname << name << " ";
+			datarepr.filename.str("");
+			datarepr.filename << filename;
+			if (numOfValues > 1)
+				datarepr.filename << "_" << name << "_";
+
+			datarepr.addImage((*imageIter));
+
+			++(datarepr.id);
+		}
+		//MAIN FUNCTION:
+		datarepr.fillImages(graphDataVec);
+		return filename;
+	}
+
+	// average of every value over all channels of the payload, in descriptor order
+	template<class Payload>
+	void genericExtract(Payload const & payload, std::vector<float> &values){
+		typedef typename PayloadItem<Payload>::type Item;
+		typedef FieldDescriptor<Item> Fields;
+
+		ContainerView<Payload> allContainers(payload);
+		typename ContainerView<Payload>::const_iterator iter;
+		typename ContainerView<Payload>::Span::const_iterator contIter;
+
+		values.assign(Fields::nValues, 0.0);
+		unsigned int size = 0;
+		for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
+			for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
+				for (unsigned int i = 0; i < Fields::nValues; ++i)
+					values[i] += Fields::value(*contIter, i);
+				++size;
+			}
+		}
+		if (size == 0)
+			return;
+		for (unsigned int i = 0; i < Fields::nValues; ++i)
+			values[i] /= size;
+	}
+}
+#endif
@@ -0,0 +1,39 @@
+#ifndef HcalImageRenderer_h
+#define HcalImageRenderer_h
+
+#include <string>
+#include <vector>
+
+#include "TH1F.h"
+#include "TH2F.h"
+
+#include "FWCore/PluginManager/interface/PluginFactory.h"
+
+//drawing of histograms into image files, kept out of the inspector libraries
+namespace HcalObjRepresent{
+
+	// Implemented in the CondCoreHcalPluginsRenderer plugin, the only library linked with ROOT
+	// graphics. It is loaded through ImageRendererFactory on the first plot, so summary() and
+	// extract() never load or initialize libGpad and friends. Calls must hold RootLock.
+	// Only copies of the given histograms are drawn, so the caller's histograms are never marked
+	// for ROOT cleanup and may be destroyed after the lock is released.
+	class ImageRenderer
+	{
+	public:
+		virtual ~ImageRenderer(){}
+
+		// 4 depth histograms one under another
+		virtual void drawDepths(std::vector<TH2F> &graphData, std::string const & filename) = 0;
+
+		virtual void drawImage(TH2F &image, std::string const & filename, int width, int height) = 0;
+
+		// 1D histograms one under another (depth profiles, subdetector distributions), drawn with option
+		virtual void drawHistograms(std::vector<TH1F> &histograms, std::string const & filename, std::string const & option) = 0;
+	};
+
+	typedef edmplugin::PluginFactory<ImageRenderer* (void)> ImageRendererFactory;
+
+	// Renderer created by the factory on first call, shared by the whole process.
+	ImageRenderer & imageRenderer();
+}
+#endif
@@ -0,0 +1,86 @@
+#ifndef HcalOutliers_h
+#define HcalOutliers_h
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "DataFormats/DetId/interface/DetId.h"
+
+#include "CondCore/HcalPlugins/interface/HcalChannelValues.h"
+#include "CondCore/HcalPlugins/interface/HcalCoverage.h"
+
+//robust outlier search in the values of a payload
+namespace HcalObjRepresent{
+
+	// Values of HB/HE/HO/HF channels are collected per subdetector, run() then finds for every
+	// subdetector and value the median and the median absolute deviation (MAD) by nth_element
+	// on one scratch buffer. A value is an outlier if |value - median| > threshold * 1.4826 * MAD
+	// (1.4826 * MAD is the standard deviation of normal data). If MAD is 0 (more than half of
+	// the values equal the median) there is no scale, so that value is not tested in that
+	// subdetector; summary() says so.
+	class Outliers
+	{
+	public:
+		enum Subdet {HB, HE, HO, HF, nSubdets};
+
+		// one outlying value of a channel
+		struct Entry{
+			uint32_t rawId;
+			unsigned int value;
+			float x, deviation;
+		};
+
+		Outliers(std::vector<std::string> const & names, float threshold);
+
+		// values of channel, names.size() floats
+		void add(DetId id, float const * values);
+
+		void run();
+
+		unsigned int nValues() const {return m_names.size();}
+		float threshold() const {return m_threshold;}
+
+		float median(unsigned int subdet, unsigned int value) const {return m_median.at(subdet).at(value);}
+		float mad(unsigned int subdet, unsigned int value) const {return m_mad.at(subdet).at(value);}
+		unsigned int count(unsigned int subdet, unsigned int value) const {return m_counts.at(subdet).at(value);}
+
+		std::vector<Entry> const & entries() const {return m_entries;}
+		// raw ids of channels with some outlying value, each once
+		std::vector<int> flagged() const;
+
+		// median, MAD and outlier count per subdetector and value, outliers listed
+		std::string summary() const;
+
+		// four depth maps of number of outlying values per cell, saved as filename_Outliers
+		std::string plot(std::string const & filename) const;
+
+	private:
+		std::vector<std::string> m_names;
+		float m_threshold;
+
+		// per subdetector: raw ids of channels and their values, row after row
+		std::vector<std::vector<uint32_t> > m_rawIds;
+		std::vector<std::vector<float> > m_values;
+
+		std::vector<std::vector<float> > m_median, m_mad;
+		std::vector<std::vector<unsigned int> > m_counts;
+		std::vector<Entry> m_entries;
+	};
+
+	template<class Payload>
+	Outliers outliersOf(Payload const & payload, float threshold){
+		typedef ChannelLookup<Payload> Lookup;
+		Outliers outliers(valueNames<Payload>(), threshold);
+		std::vector<float> values(Lookup::nValues());
+		if (!values.empty()){
+			std::vector<DetId> channels = PayloadChannels<Payload>::get(payload);
+			for (std::vector<DetId>::const_iterator id = channels.begin(); id != channels.end(); ++id)
+				if (Lookup::get(payload, *id, &values[0]))
+					outliers.add(*id, &values[0]);
+		}
+		outliers.run();
+		return outliers;
+	}
+}
+#endif
@@ -0,0 +1,116 @@
+#ifndef HcalPayloadCache_h
+#define HcalPayloadCache_h
+
+#include <string>
+#include <list>
+#include <map>
+#include <utility>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/function.hpp>
+#include <boost/thread/mutex.hpp>
+
+//payloads shared between IOVs which point to the same object
+//(src/HcalPayloadCache.cc is library CondCoreHcalPluginsPayloadCache, without ROOT, shared by the
+//Rcds plugins and the python modules; it is skipped in CondCoreHcalPlugins)
+namespace HcalObjRepresent{
+
+	struct PayloadCacheCounters
+	{
+		PayloadCacheCounters():hits(0), misses(0), evictions(0), entries(0){}
+		unsigned long hits, misses, evictions;
+		unsigned int entries;
+	};
+
+	// Number of payloads kept per payload type, default 4 or HCAL_PAYLOAD_CACHE_SIZE from the
+	// environment; 0 switches caching off.
+	// A smaller capacity takes effect on the next load of each type.
+	void setPayloadCacheCapacity(unsigned int entries);
+	unsigned int payloadCacheCapacity();
+
+	// Counters of every payload cache of the process, one line per type.
+	std::string payloadCacheReport();
+
+	// Counters and registration in payloadCacheReport(), common to all payload types.
+	class PayloadCacheBase
+	{
+	public:
+		explicit PayloadCacheBase(std::string const & name);
+		virtual ~PayloadCacheBase();
+
+		std::string const & name() const {return m_name;}
+
+		PayloadCacheCounters counters() const {
+			boost::mutex::scoped_lock lock(m_mutex);
+			return m_counters;
+		}
+
+	protected:
+		mutable boost::mutex m_mutex;
+		PayloadCacheCounters m_counters;
+
+	private:
+		std::string m_name;
+
+		PayloadCacheBase(PayloadCacheBase const &);
+		PayloadCacheBase & operator=(PayloadCacheBase const &);
+	};
+
+	// Least recently used payloads of type T, keyed on payload token. Payloads are handed out
+	// as shared immutable objects, so an evicted payload stays alive while a proxy still uses it.
+	template<class T>
+	class PayloadCache: public PayloadCacheBase
+	{
+	public:
+		typedef boost::shared_ptr<const T> Payload;
+		typedef boost::function<boost::shared_ptr<T> ()> Loader;
+
+		explicit PayloadCache(std::string const & name):PayloadCacheBase(name){}
+
+		// Cached payload of token, otherwise the one returned by load (which may be empty).
+		// Loading is done without the lock; if two threads load the same token, the first one is kept.
+		Payload get(std::string const & token, Loader const & load){
+			{
+				boost::mutex::scoped_lock lock(m_mutex);
+				typename Index::iterator found = m_index.find(token);
+				if (found != m_index.end()){
+					++m_counters.hits;
+					m_entries.splice(m_entries.begin(), m_entries, found->second);
+					return found->second->second;
+				}
+				++m_counters.misses;
+			}
+
+			Payload payload(load());
+			if (!payload)
+				return payload;
+
+			boost::mutex::scoped_lock lock(m_mutex);
+			unsigned int capacity = payloadCacheCapacity();
+			typename Index::iterator found = m_index.find(token);
+			if (found != m_index.end())
+				payload = found->second->second;
+			else if (capacity > 0){
+				m_entries.push_front(Entry(token, payload));
+				m_index[token] = m_entries.begin();
+			}
+			while (m_entries.size() > capacity){
+				m_index.erase(m_entries.back().first);
+				m_entries.pop_back();
+				++m_counters.evictions;
+			}
+			m_counters.entries = m_entries.size();
+			return payload;
+		}
+
+	private:
+		typedef std::pair<std::string, Payload> Entry;
+		//most recently used first
+		typedef std::list<Entry> Entries;
+		typedef std::map<std::string, typename Entries::iterator> Index;
+
+		Entries m_entries;
+		Index m_index;
+	};
+}
+#endif
@@ -0,0 +1,496 @@
+#ifndef HcalPythonWrapper_h
+#define HcalPythonWrapper_h
+
+#include "CondCore/Utilities/interface/PayLoadInspector.h"
+#include "CondCore/Utilities/interface/InspectorPythonWrapper.h"
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <stdexcept>
+
+#include <boost/python.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/bind.hpp>
+#include <boost/ref.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include "CondCore/HcalPlugins/interface/HcalBatchInspector.h"
+#include "CondCore/HcalPlugins/interface/HcalPayloadCache.h"
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalChannelValues.h"
+#include "CondCore/HcalPlugins/interface/HcalCoverage.h"
+#include "CondCore/HcalPlugins/interface/HcalOutliers.h"
+#include "CondCore/HcalPlugins/interface/HcalTriggerTowers.h"
+#include "CondCore/HcalPlugins/interface/HcalStability.h"
+
+// Python bindings of HCAL inspectors. Same module as PYTHON_WRAPPER, but summary(), plot()
+// and extract() run without the GIL, and summary_async()/plot_async() return a Future
+// computed on the inspector pool, so python threads get real parallelism.
+// values(rawIds) returns values of the given channels (row after row, valueNames() are the columns).
+// coverage() compares the channels of the payload with the valid HB/HE/HO/HF cells.
+// outliers(threshold) finds values far from the median of their subdetector, in units of MAD.
+// m = stabilityMap(); obj.addToStability(m) for every IOV gives per channel mean/RMS/min/max over time.
+// b = Batch(); obj.addSummaryTo(b, record), addPlotTo(b, record, ...) or addExtractTo(b, record) for
+// inspectors of any type, then b.run() gives (record, output, error, memory report) tuples in order of adding.
+// setBoundedMemory(True) makes every call (also Future and Batch jobs) release the ROOT objects it
+// registered, memoryReport() gives resident memory before, at peak and after the last synchronous
+// call of the thread; Future.memoryReport() and Batch results give it per job.
+// setProfiles(True) makes plot() save ieta ring and iphi sector profiles of every image too,
+// setDistributions(True) histograms of its values per subdetector (setDistributionBinning(n, min, max)).
+// setPayloadCacheCapacity(n) and payloadCacheReport() reach the payload caches of the EventSetup
+// proxies in the same process (HcalPayloadCache.h).
+// ROOT global state of plots is guarded separately (RootLock in HcalObjRepresent.h).
+// Functions and classes of a single payload type are added by specializing PythonExtras.
+namespace HcalObjRepresent{
+
+	// Releases the GIL for the lifetime of the object, the calling thread must hold it.
+	class ReleaseGIL
+	{
+	public:
+		ReleaseGIL():m_state(PyEval_SaveThread()){}
+		~ReleaseGIL(){PyEval_RestoreThread(m_state);}
+	private:
+		PyThreadState * m_state;
+		ReleaseGIL(ReleaseGIL const &);
+		ReleaseGIL & operator=(ReleaseGIL const &);
+	};
+
+	// Result of job running on the inspector pool. Keeps the python inspector object alive
+	// until the job is finished; get() and the last copy going away wait without holding the GIL.
+	class AsyncResult
+	{
+	public:
+		AsyncResult(){}
+
+		AsyncResult(boost::python::object const & owner, BatchInspector::Job const & job)
+			:m_keeper(new Keeper(owner)){
+			inspectorPool().submit(boost::bind(&AsyncResult::run, m_keeper->state, job));
+		}
+
+		bool ready() const {
+			if (!m_keeper)
+				return true;
+			boost::mutex::scoped_lock lock(m_keeper->state->mutex);
+			return m_keeper->state->done;
+		}
+
+		// output of job, RuntimeError if job failed
+		std::string get() const {
+			if (!m_keeper)
+				throw std::runtime_error("empty Future");
+			State const & state = *(m_keeper->state);
+			{
+				ReleaseGIL nogil;
+				m_keeper->wait();
+			}
+			if (!state.error.empty())
+				throw std::runtime_error(state.error);
+			return state.output;
+		}
+
+		// MemoryReport of the job, empty unless in bounded-memory mode; waits as get()
+		std::string memoryReport() const {
+			if (!m_keeper)
+				return "";
+			{
+				ReleaseGIL nogil;
+				m_keeper->wait();
+			}
+			return m_keeper->state->memory;
+		}
+
+	private:
+		//shared by the job and the keeper
+		struct State
+		{
+			State():done(false){}
+			boost::mutex mutex;
+			boost::condition_variable finished;
+			bool done;
+			std::string output, error, memory;
+		};
+
+		//shared by copies of the python Future
+		struct Keeper
+		{
+			explicit Keeper(boost::python::object const & o):state(new State()), owner(o){}
+			~Keeper(){
+				ReleaseGIL nogil;
+				wait();
+			}
+			void wait() const {
+				boost::mutex::scoped_lock lock(state->mutex);
+				while (!state->done)
+					state->finished.wait(lock);
+			}
+			boost::shared_ptr<State> state;
+			//released only after the job is finished, with GIL held again
+			boost::python::object owner;
+		};
+		boost::shared_ptr<Keeper> m_keeper;
+
+		static void run(boost::shared_ptr<State> state, BatchInspector::Job job){
+			BatchInspector::Result result;
+			BatchInspector::execute(job, result);
+			boost::mutex::scoped_lock lock(state->mutex);
+			state->output = result.output;
+			state->error = result.error;
+			state->memory = result.memory;
+			state->done = true;
+			state->finished.notify_all();
+		}
+	};
+
+	// Classes shared by all HCAL modules (Future, Batch, Coverage, Outliers, TriggerTowers,
+	// StabilityMap) are registered by the first module imported that needs them, boost.python
+	// allows one registration per C++ type. If T is registered already, binds name to the
+	// existing class in the current module and returns true.
+	template<class T>
+	bool alreadyRegistered(char const * name){
+		using namespace boost::python;
+		converter::registration const * reg = converter::registry::query(type_id<T>());
+		if (!reg || !reg->m_class_object)
+			return false;
+		scope().attr(name) = handle<>(borrowed(reg->m_class_object));
+		return true;
+	}
+
+	inline void defineAsyncResult(){
+		using namespace boost::python;
+		if (alreadyRegistered<AsyncResult>("Future"))
+			return;
+		class_<AsyncResult>("Future", init<>())
+			.def("ready", &AsyncResult::ready)
+			.def("get", &AsyncResult::get)
+			.def("memoryReport", &AsyncResult::memoryReport)
+			;
+	}
+
+	// Jobs of inspectors of any payload type, run together on the inspector pool without the GIL.
+	// Keeps the python inspector objects alive until run() is finished; one thread at a time.
+	class PythonBatch
+	{
+	public:
+		void add(boost::python::object const & owner, std::string const & record, BatchInspector::Job const & job){
+			m_owners.push_back(owner);
+			m_batch.add(record, job);
+		}
+
+		unsigned int size() const {return m_batch.size();}
+
+		boost::python::list run(){
+			std::vector<BatchInspector::Result> results;
+			{
+				ReleaseGIL nogil;
+				results = m_batch.run();
+			}
+			m_owners.clear();
+
+			boost::python::list out;
+			for (std::vector<BatchInspector::Result>::const_iterator r = results.begin(); r != results.end(); ++r)
+				out.append(boost::python::make_tuple(r->record, r->output, r->error, r->memory));
+			return out;
+		}
+
+	private:
+		BatchInspector m_batch;
+		std::vector<boost::python::object> m_owners;
+	};
+
+	inline void defineBatch(){
+		using namespace boost::python;
+		if (alreadyRegistered<PythonBatch>("Batch"))
+			return;
+		class_<PythonBatch, boost::noncopyable>("Batch", init<>())
+			.def("size", &PythonBatch::size)
+			.def("run", &PythonBatch::run)
+			;
+	}
+
+	// plot() of the shared classes runs without the GIL, in bounded-memory mode if enabled
+	inline std::string plotCoverage(Coverage const & self, std::string const & filename){
+		ReleaseGIL nogil;
+		BoundedMemoryScope memory;
+		return self.plot(filename);
+	}
+
+	inline void defineCoverage(){
+		using namespace boost::python;
+		if (alreadyRegistered<Coverage>("Coverage"))
+			return;
+		class_<Coverage>("Coverage", init<>())
+			.def("nChannels", &Coverage::nChannels)
+			.def("nCovered", &Coverage::nCovered)
+			.def("nMissing", &Coverage::nMissing)
+			.def("nExtra", &Coverage::nExtra)
+			.def("missing", &Coverage::missing)
+			.def("extra", &Coverage::extra)
+			.def("summary", &Coverage::summary)
+			.def("plot", &plotCoverage)
+			;
+	}
+
+	inline std::string plotOutliers(Outliers const & self, std::string const & filename){
+		ReleaseGIL nogil;
+		BoundedMemoryScope memory;
+		return self.plot(filename);
+	}
+
+	inline std::vector<int> outlierValues(Outliers const & self){
+		std::vector<int> values;
+		for (std::vector<Outliers::Entry>::const_iterator entry = self.entries().begin(); entry != self.entries().end(); ++entry)
+			values.push_back(entry->value);
+		return values;
+	}
+
+	inline void defineOutliers(){
+		using namespace boost::python;
+		if (alreadyRegistered<Outliers>("Outliers"))
+			return;
+		class_<Outliers>("Outliers", no_init)
+			.def("threshold", &Outliers::threshold)
+			.def("median", &Outliers::median)
+			.def("mad", &Outliers::mad)
+			.def("count", &Outliers::count)
+			.def("flagged", &Outliers::flagged)
+			//value number of every outlier, as listed in summary
+			.def("flaggedValues", &outlierValues)
+			.def("summary", &Outliers::summary)
+			.def("plot", &plotOutliers)
+			;
+	}
+
+	inline std::string plotTowers(TriggerTowers const & self, std::string const & filename){
+		ReleaseGIL nogil;
+		BoundedMemoryScope memory;
+		return self.plot(filename);
+	}
+
+	// defined only by the LUT modules, which have towers() (their PythonExtras)
+	inline void defineTriggerTowers(){
+		using namespace boost::python;
+		if (alreadyRegistered<TriggerTowers>("TriggerTowers"))
+			return;
+		class_<TriggerTowers>("TriggerTowers", no_init)
+			.def("names", &TriggerTowers::names, return_value_policy<copy_const_reference>())
+			.def("nTowers", &TriggerTowers::nTowers)
+			.def("nCells", &TriggerTowers::nCells)
+			//value(ieta, iphi, value number, statistic: 0 mean, 1 min, 2 max, 3 spread)
+			.def("value", &TriggerTowers::value)
+			.def("summary", &TriggerTowers::summary)
+			.def("plot", &plotTowers)
+			;
+	}
+
+	template<class T>
+	TriggerTowers inspectorTowers(cond::PayLoadInspector<T> const & self){
+		ReleaseGIL nogil;
+		return towersOf(self.object());
+	}
+
+	inline std::string plotStability(StabilityMap const & self, std::string const & filename){
+		ReleaseGIL nogil;
+		BoundedMemoryScope memory;
+		return self.plot(filename);
+	}
+
+	inline void defineStabilityMap(){
+		using namespace boost::python;
+		if (alreadyRegistered<StabilityMap>("StabilityMap"))
+			return;
+		class_<StabilityMap>("StabilityMap", no_init)
+			.def("names", &StabilityMap::names, return_value_policy<copy_const_reference>())
+			.def("nPayloads", &StabilityMap::nPayloads)
+			.def("count", &StabilityMap::count)
+			.def("mean", &StabilityMap::mean)
+			.def("rms", &StabilityMap::rms)
+			.def("min", &StabilityMap::min)
+			.def("max", &StabilityMap::max)
+			.def("leastStable", &StabilityMap::leastStable)
+			.def("merge", &StabilityMap::merge)
+			.def("summary", &StabilityMap::summary)
+			.def("plot", &plotStability)
+			.def("save", &StabilityMap::save)
+			.def("load", &StabilityMap::load)
+			.staticmethod("load")
+			;
+	}
+
+	// Jobs built on the PayLoadInspector<T> specializations. They have to be created in the
+	// translation unit that defines summary()/plot()/ValueExtractor of T (the PyWrapper of T);
+	// inspector is taken by reference and must outlive the job.
+
+	template<class T>
+	BatchInspector::Job summaryJob(cond::PayLoadInspector<T> const & inspector){
+		return boost::bind(&cond::PayLoadInspector<T>::summary, boost::cref(inspector));
+	}
+
+	template<class T>
+	BatchInspector::Job plotJob(cond::PayLoadInspector<T> const & inspector, std::string const & filename,
+		std::string const & opt = "", std::vector<int> const & ints = std::vector<int>(),
+		std::vector<float> const & floats = std::vector<float>()){
+		return boost::bind(&cond::PayLoadInspector<T>::plot, boost::cref(inspector), filename, opt, ints, floats);
+	}
+
+	// extracted values, space separated
+	template<class T>
+	std::string extractValues(cond::PayLoadInspector<T> const & inspector){
+		typename cond::PayLoadInspector<T>::Extractor extractor;
+		inspector.extract(extractor);
+
+		std::stringstream ss;
+		std::vector<float> const & values = extractor.values();
+		for (unsigned int i = 0; i < values.size(); ++i)
+			ss << (i == 0 ? "" : " ") << values[i];
+		return ss.str();
+	}
+
+	template<class T>
+	BatchInspector::Job extractJob(cond::PayLoadInspector<T> const & inspector){
+		return boost::bind(&extractValues<T>, boost::cref(inspector));
+	}
+
+	// GIL free calls of PayLoadInspector<T>
+	template<class T>
+	struct GilFreeInspector
+	{
+		typedef cond::PayLoadInspector<T> Inspector;
+
+		static std::string summary(Inspector const & self){
+			ReleaseGIL nogil;
+			BoundedMemoryScope memory;
+			return self.summary();
+		}
+
+		static std::string plot(Inspector const & self, std::string const & filename, std::string const & opt,
+			std::vector<int> const & ints, std::vector<float> const & floats){
+			ReleaseGIL nogil;
+			BoundedMemoryScope memory;
+			return self.plot(filename, opt, ints, floats);
+		}
+
+		static void extract(Inspector const & self, typename Inspector::Extractor & extractor){
+			ReleaseGIL nogil;
+			BoundedMemoryScope memory;
+			self.extract(extractor);
+		}
+
+		static std::vector<float> values(Inspector const & self, std::vector<int> const & rawIds){
+			std::vector<float> result;
+			ReleaseGIL nogil;
+			channelValues(self.object(), rawIds, result);
+			return result;
+		}
+
+		static std::vector<std::string> names(Inspector const &){
+			return valueNames<T>();
+		}
+
+		static Coverage coverage(Inspector const & self){
+			ReleaseGIL nogil;
+			return coverageOf(self.object());
+		}
+
+		static Outliers outliers(Inspector const & self, float threshold){
+			ReleaseGIL nogil;
+			return outliersOf(self.object(), threshold);
+		}
+
+		// empty map for payloads of type T
+		static StabilityMap stabilityMap(){
+			return StabilityMap(valueNames<T>());
+		}
+
+		static void addToStability(Inspector const & self, StabilityMap &map){
+			if (map.names() != valueNames<T>())
+				throw std::runtime_error("stability map of other payload type");
+			ReleaseGIL nogil;
+			HcalObjRepresent::addToStability(map, self.object());
+		}
+
+		static AsyncResult summaryAsync(boost::python::object self){
+			Inspector const & inspector = boost::python::extract<Inspector const &>(self);
+			return AsyncResult(self, summaryJob(inspector));
+		}
+
+		static AsyncResult plotAsync(boost::python::object self, std::string const & filename, std::string const & opt,
+			std::vector<int> const & ints, std::vector<float> const & floats){
+			Inspector const & inspector = boost::python::extract<Inspector const &>(self);
+			return AsyncResult(self, plotJob(inspector, filename, opt, ints, floats));
+		}
+
+		static void addSummaryTo(boost::python::object self, PythonBatch &batch, std::string const & record){
+			Inspector const & inspector = boost::python::extract<Inspector const &>(self);
+			batch.add(self, record, summaryJob(inspector));
+		}
+
+		static void addPlotTo(boost::python::object self, PythonBatch &batch, std::string const & record,
+			std::string const & filename, std::string const & opt, std::vector<int> const & ints, std::vector<float> const & floats){
+			Inspector const & inspector = boost::python::extract<Inspector const &>(self);
+			batch.add(self, record, plotJob(inspector, filename, opt, ints, floats));
+		}
+
+		static void addExtractTo(boost::python::object self, PythonBatch &batch, std::string const & record){
+			Inspector const & inspector = boost::python::extract<Inspector const &>(self);
+			batch.add(self, record, extractJob(inspector));
+		}
+	};
+
+	// Python functions and classes only one payload type has. Specialize in the PyWrapper of T
+	// before HCAL_PYTHON_WRAPPER; define() runs in the module of T, after Object and What.
+	template<class T>
+	struct PythonExtras
+	{
+		static void define(){}
+	};
+}
+
+#define HCAL_PYTHON_WRAPPER(_class,_name) \
+namespace { typedef cond::PayLoadInspector< _class > PythonWrapper; \
+	typedef HcalObjRepresent::GilFreeInspector< _class > GilFree;} \
+BOOST_PYTHON_MODULE(plugin ## _name ## PyInterface) { \
+	using namespace boost::python; \
+	HcalObjRepresent::defineAsyncResult(); \
+	HcalObjRepresent::defineBatch(); \
+	HcalObjRepresent::defineCoverage(); \
+	HcalObjRepresent::defineOutliers(); \
+	HcalObjRepresent::defineStabilityMap(); \
+	def("stabilityMap",&GilFree::stabilityMap); \
+	def("setBoundedMemory",&HcalObjRepresent::setBoundedMemory); \
+	def("setProfiles",&HcalObjRepresent::setProfiles); \
+	def("setDistributions",&HcalObjRepresent::setDistributions); \
+	def("setDistributionBinning",&HcalObjRepresent::setDistributionBinning); \
+	def("memoryReport",&HcalObjRepresent::BoundedMemoryScope::lastMemoryReport); \
+	def("setPayloadCacheCapacity",&HcalObjRepresent::setPayloadCacheCapacity); \
+	def("payloadCacheCapacity",&HcalObjRepresent::payloadCacheCapacity); \
+	def("payloadCacheReport",&HcalObjRepresent::payloadCacheReport); \
+	class_<PythonWrapper>("Object",init<>()) \
+		.def(init<cond::IOVElementProxy&>()) \
+		.def("load",&PythonWrapper::load) \
+		.def("dump",&PythonWrapper::dump) \
+		.def("plot",&GilFree::plot) \
+		.def("summary",&GilFree::summary) \
+		.def("extract",&GilFree::extract) \
+		.def("values",&GilFree::values) \
+		.def("valueNames",&GilFree::names) \
+		.def("coverage",&GilFree::coverage) \
+		.def("outliers",&GilFree::outliers) \
+		.def("addToStability",&GilFree::addToStability) \
+		.def("trend_plot",&PythonWrapper::trend_plot) \
+		.def("plot_async",&GilFree::plotAsync) \
+		.def("summary_async",&GilFree::summaryAsync) \
+		.def("addSummaryTo",&GilFree::addSummaryTo) \
+		.def("addPlotTo",&GilFree::addPlotTo) \
+		.def("addExtractTo",&GilFree::addExtractTo); \
+	condPython::defineWhat< _class >(); \
+	HcalObjRepresent::PythonExtras< _class >::define(); \
+	typedef cond::ExtractWhat< PythonWrapper::Class> What; \
+	class_<PythonWrapper::Extractor>("Extractor", init<>()) \
+		.def(init<What>()) \
+		.def("what",&PythonWrapper::Extractor::what) \
+		.def("values",&PythonWrapper::Extractor::values, return_value_policy<copy_const_reference>()) \
+		; \
+}
+#endif
@@ -0,0 +1,85 @@
+#ifndef HcalStability_h
+#define HcalStability_h
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "DataFormats/DetId/interface/DetId.h"
+
+#include "CondCore/HcalPlugins/interface/HcalChannelIndex.h"
+#include "CondCore/HcalPlugins/interface/HcalChannelValues.h"
+#include "CondCore/HcalPlugins/interface/HcalCoverage.h"
+
+//stability of channel values over a sequence of payloads of one type
+namespace HcalObjRepresent{
+
+	// Running count, mean, variance (Welford), min and max of every value of every ChannelIndex slot.
+	// Payloads are added one at a time and are not kept, so memory does not depend on the number of IOVs.
+	// Maps of parts of an IOV range (e.g. made by different processes, see save() and load()) can be
+	// merged, giving the same result as one map of the whole range.
+	class StabilityMap
+	{
+	public:
+		StabilityMap(std::vector<std::string> const & names);
+
+		// values of cell, names().size() floats; countPayload() once per payload
+		void add(unsigned int slot, float const * values);
+		void countPayload(){++m_nPayloads;}
+
+		// names of both maps must be equal
+		void merge(StabilityMap const & other);
+
+		std::vector<std::string> const & names() const {return m_names;}
+		unsigned int nPayloads() const {return m_nPayloads;}
+
+		// payloads in which channel was found; statistics are NaN for channels never found
+		unsigned int count(int rawId) const;
+		float mean(int rawId, unsigned int value) const;
+		float rms(int rawId, unsigned int value) const;
+		float min(int rawId, unsigned int value) const;
+		float max(int rawId, unsigned int value) const;
+
+		// raw ids of at most n channels with largest RMS of value, largest first
+		std::vector<int> leastStable(unsigned int value, unsigned int n) const;
+
+		// payloads and channels, per value the n least stable channels
+		std::string summary(unsigned int n) const;
+
+		// four depth maps of RMS per value, saved as filename_<value>_RMS.png
+		std::string plot(std::string const & filename) const;
+
+		// binary file with the whole state, for merging maps of other processes
+		void save(std::string const & filename) const;
+		static StabilityMap load(std::string const & filename);
+
+	private:
+		std::vector<std::string> m_names;
+		unsigned int m_nPayloads;
+
+		// per slot: payloads with the channel; per slot and value: mean, sum of squared deviations, min, max
+		std::vector<uint32_t> m_counts;
+		std::vector<double> m_mean, m_m2;
+		std::vector<float> m_min, m_max;
+
+		int slotOf(int rawId, unsigned int value) const;
+		float slotRms(unsigned int slot, unsigned int value) const;
+	};
+
+	// adds values of all HB/HE/HO/HF cells of payload
+	template<class Payload>
+	void addToStability(StabilityMap &map, Payload const & payload){
+		typedef ChannelLookup<Payload> Lookup;
+		std::vector<float> values(Lookup::nValues());
+		if (!values.empty()){
+			std::vector<DetId> channels = PayloadChannels<Payload>::get(payload);
+			for (std::vector<DetId>::const_iterator id = channels.begin(); id != channels.end(); ++id){
+				int slot = ChannelIndex::slot(*id);
+				if (slot >= 0 && Lookup::get(payload, *id, &values[0]))
+					map.add(slot, &values[0]);
+			}
+		}
+		map.countPayload();
+	}
+}
+#endif
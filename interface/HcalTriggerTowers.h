@@ -0,0 +1,111 @@
+#ifndef HcalTriggerTowers_h
+#define HcalTriggerTowers_h
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "CondCore/HcalPlugins/interface/HcalChannelIndex.h"
+#include "CondCore/HcalPlugins/interface/HcalChannelValues.h"
+
+//HCAL cell values aggregated into trigger towers
+namespace HcalObjRepresent{
+
+	// Trigger towers of HB/HE/HF cells (HO has none), numbered as by HcalTrigTowerGeometry:
+	//   HB/HE: tower ieta is cell ieta, ring 29 goes into tower 28; cells of rings 21-29 span
+	//          10 degrees and belong to both towers iphi and iphi+1.
+	//   HF: depth 1 cells of rings 29-31, 32-34, 35-37, 38-41 are towers 29-32, 20 degrees wide,
+	//       at iphi 1, 5, ..., 69; depth 2 cells belong to no tower.
+	// Towers of every ChannelIndex slot are computed once.
+	class TowerIndex
+	{
+	public:
+		static const int maxIeta = 32;
+		static const int nPhi = 72;
+		static const unsigned int nTowers = 2 * maxIeta * nPhi;
+
+		// slot of tower, -1 if ieta or iphi is out of range
+		static int slot(int ieta, int iphi){
+			if (ieta == 0 || ieta < -maxIeta || ieta > maxIeta || iphi < 1 || iphi > nPhi)
+				return -1;
+			return (ieta < 0 ? ieta + maxIeta : ieta + maxIeta - 1) * nPhi + iphi - 1;
+		}
+		static int ieta(unsigned int slot){
+			int i = slot / nPhi;
+			return i < maxIeta ? i - maxIeta : i - maxIeta + 1;
+		}
+		static int iphi(unsigned int slot){return slot % nPhi + 1;}
+
+		// tower slots of cell slot, second is -1 for cells in one tower; both -1 for HO and HF depth 2
+		static std::pair<int, int> const & towers(unsigned int cellSlot){return table()[cellSlot];}
+
+	private:
+		static std::vector<std::pair<int, int> > const & table();
+	};
+
+	// Mean, min, max and spread (standard deviation) of every value over the cells of each tower,
+	// filled in one pass over the payload.
+	class TriggerTowers
+	{
+	public:
+		enum Stat {Mean, Min, Max, Spread, nStats};
+
+		TriggerTowers(std::vector<std::string> const & names);
+
+		// values of cell, names().size() floats
+		void add(unsigned int cellSlot, float const * values);
+
+		std::vector<std::string> const & names() const {return m_names;}
+		static std::string statName(unsigned int stat);
+
+		// towers with some cell
+		unsigned int nTowers() const;
+		unsigned int nCells(int ieta, int iphi) const;
+		// NaN for towers without cells
+		float value(int ieta, int iphi, unsigned int value, unsigned int stat) const;
+
+		// per value: towers, range of tower means, largest spread and its tower
+		std::string summary() const;
+
+		// one tower map per value and statistic, saved as filename_<value>_<stat>.png
+		std::string plot(std::string const & filename) const;
+
+	private:
+		struct Sums
+		{
+			Sums():sum(0.0), sqrSum(0.0), min(0), max(0){}
+			double sum, sqrSum;
+			float min, max;
+		};
+
+		std::vector<std::string> m_names;
+		// nValues sums per tower slot
+		std::vector<Sums> m_sums;
+		std::vector<unsigned int> m_cells;
+
+		void addToTower(int tower, float const * values);
+		float stat(unsigned int tower, unsigned int value, unsigned int stat) const;
+	};
+
+	template<class Item>
+	struct StoreTowerValues
+	{
+		typedef FieldDescriptor<Item> Fields;
+		TriggerTowers &towers;
+		void operator()(int slot, Item const & item){
+			float values[Fields::nValues];
+			for (unsigned int i = 0; i < Fields::nValues; ++i)
+				values[i] = Fields::value(item, i);
+			towers.add(slot, values);
+		}
+	};
+
+	template<class Payload>
+	TriggerTowers towersOf(Payload const & payload){
+		TriggerTowers towers(valueNames<Payload>());
+		StoreTowerValues<typename PayloadItem<Payload>::type> store = {towers};
+		forEachCell(payload, store);
+		return towers;
+	}
+}
+#endif
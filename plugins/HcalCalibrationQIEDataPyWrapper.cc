@@ -0,0 +1,220 @@
+#include "CondFormats/HcalObjects/interface/HcalCalibrationQIEData.h"
+#include "CondFormats/HcalObjects/interface/HcalCalibrationQIECoder.h"
+
+#include "CondCore/Utilities/interface/PayLoadInspector.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
+
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <map>
+
+#include "TH1F.h"
+#include "TH2F.h"
+#include "DataFormats/DetId/interface/DetId.h"
+#include "DataFormats/HcalDetId/interface/HcalDetId.h"
+#include "DataFormats/HcalDetId/interface/HcalCalibDetId.h"
+
+#include "TROOT.h"
+
+#include "math.h"
+//functions for correct representation of data in summary and plot:
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
+using namespace HcalObjRepresent;
+
+namespace {
+	//HcalCalibrationQIECoder stores 32 minimal charges, one per QIE bin
+	const unsigned int nBins = 32;
+
+	//all 32 parameters of coder
+	void getCalibrationQIEParameters(HcalCalibrationQIECoder const & coder, float * values){
+		const float * charges = coder.minCharges();
+		for (unsigned int fBin = 0; fBin < nBins; ++fBin)
+			values[fBin] = charges[fBin];
+	}
+
+	std::string subdetName(int subdet){
+		switch(subdet){
+			case HcalBarrel: return "HB";
+			case HcalEndcap: return "HE";
+			case HcalOuter: return "HO";
+			case HcalForward: return "HF";
+			default: return "Other";
+		}
+	}
+
+	// Calibration channels are grouped by calibration type and subdetector
+	// (e.g. "CALIB HB CalibrationBox"), other channels by their container name.
+	std::string channelGroup(std::string const & container, uint32_t rawId){
+		DetId detId(rawId);
+		if (detId.det() != DetId::Hcal || detId.subdetId() != HcalOther)
+			return container;
+
+		HcalCalibDetId calibId(rawId);
+		std::string flavor;
+		switch(calibId.calibFlavor()){
+			case HcalCalibDetId::CalibrationBox:
+				flavor = "CalibrationBox";
+				break;
+			case HcalCalibDetId::HOCrosstalk:
+				flavor = "HOCrosstalk";
+				break;
+			default:
+				flavor = "Other";
+		}
+		return container + " " + subdetName(calibId.hcalSubdet()) + " " + flavor;
+	}
+
+	// Minimal charges of all channels of one group, nBins floats per channel
+	struct ChannelGroup
+	{
+		std::vector<uint32_t> rawIds;
+		std::vector<float> charges;
+	};
+	typedef std::map<std::string, ChannelGroup> tGroups;
+
+	void fillGroups(HcalCalibrationQIEData const & data, tGroups &groups){
+		ContainerView<HcalCalibrationQIEData> allContainers(data);
+		ContainerView<HcalCalibrationQIEData>::const_iterator iter;
+		ContainerView<HcalCalibrationQIEData>::Span::const_iterator contIter;
+		float parameters[nBins];
+
+		for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
+			for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
+				//skip empty slots of container
+				if ((*contIter).rawId() == 0)
+					continue;
+				ChannelGroup & group = groups[channelGroup((*iter).first, (*contIter).rawId())];
+				group.rawIds.push_back((*contIter).rawId());
+				getCalibrationQIEParameters(*contIter, parameters);
+				group.charges.insert(group.charges.end(), parameters, parameters + nBins);
+			}
+		}
+	}
+}
+
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalCalibrationQIECoder>{
+		static const unsigned int nValues = nBins;
+		static float value(HcalCalibrationQIECoder const & item, unsigned int i){
+			return item.minCharge(i);
+		}
+		static std::string name(unsigned int i){
+			return indexedName("MinCharge", i);
+		}
+	};
+}
+
+namespace cond {
+	template<>
+	class ValueExtractor<HcalCalibrationQIEData>: public  BaseValueExtractor<HcalCalibrationQIEData> {
+	public:
+		typedef HcalCalibrationQIEData Class;
+		typedef ExtractWhat<Class> What;
+		static What what() { return What();}
+
+		ValueExtractor(){}
+
+		ValueExtractor(What const & what)
+		{
+			// here one can make stuff really complicated...
+		}
+
+		//minimal charge of every QIE bin, averaged over all channels
+		void compute(Class const & it){
+			tGroups groups;
+			fillGroups(it, groups);
+
+			ParameterSums sums(nBins);
+			for (tGroups::const_iterator iter = groups.begin(); iter != groups.end(); ++iter)
+				for (unsigned int ch = 0; ch < iter->second.rawIds.size(); ++ch)
+					sums.add(&iter->second.charges[ch * nBins]);
+
+			std::vector<float> res(nBins);
+			for (unsigned int fBin = 0; fBin < nBins; ++fBin)
+				res[fBin] = sums.average(fBin, fBin + 1);
+			swap(res);
+		}
+	private:
+
+	};
+
+	template<>
+	std::string PayLoadInspector<HcalCalibrationQIEData>::summary() const {
+		std::stringstream ss;
+		tGroups groups;
+		fillGroups(object(), groups);
+
+		ss << "Total channel groups: " << groups.size() << std::endl;
+
+		//minimal charges of all bins, accumulated in one pass:
+		ParameterSums sums(nBins);
+
+		for (tGroups::const_iterator iter = groups.begin(); iter != groups.end(); ++iter){
+			ChannelGroup const & group = iter->second;
+			sums.reset();
+			for (unsigned int ch = 0; ch < group.rawIds.size(); ++ch)
+				sums.add(&group.charges[ch * nBins]);
+
+			ss << "---------------------------------------------" << std::endl;
+			ss << "Channels: " << iter->first << ";    Total values: "<< group.rawIds.size() << std::endl;
+			ss  << "    MinCharge (all bins): " << std::endl;
+			ss	<< "          Average: " << sums.average(0, nBins) << "; "<< std::endl;
+			ss	<< "          Standart deviation: " << sums.std_dev(0, nBins) << "; " << std::endl;
+			for (unsigned int fBin = 0; fBin < nBins; ++fBin){
+				ss  << "    MinCharge bin " << fBin << " :"
+					<< " Average: " << sums.average(fBin, fBin + 1) << ";"
+					<< " Standart deviation: " << sums.std_dev(fBin, fBin + 1) << ";" << std::endl;
+			}
+		}
+		return ss.str();
+	}
+
+	// Channel vs QIE bin images, not eta-phi maps: calibration channels have no ieta ring,
+	// iphi sector or depth cell, so they are not made by ADataRepr and profiles and
+	// distributions modes (setProfiles, setDistributions) do not apply to them.
+	template<>
+	std::string PayLoadInspector<HcalCalibrationQIEData>::plot(std::string const & filename,
+		std::string const &,
+		std::vector<int> const&,
+		std::vector<float> const& ) const
+	{
+		tGroups groups;
+		fillGroups(object(), groups);
+
+		//one image per channel group: channel index vs QIE bin
+		for (tGroups::const_iterator iter = groups.begin(); iter != groups.end(); ++iter){
+			ChannelGroup const & group = iter->second;
+			unsigned int nChannels = group.rawIds.size();
+
+			std::string name = iter->first;
+			for (std::string::iterator c = name.begin(); c != name.end(); ++c)
+				if (*c == ' ') *c = '_';
+
+			std::vector<TH2F> image;
+			{
+				DetachedHistograms detached;
+				image.push_back(TH2F(("_MinChargerootvalue_" + name).c_str(),
+					("MinCharge for " + iter->first).c_str(),
+					nChannels, -0.5, nChannels - 0.5,
+					nBins, -0.5, nBins - 0.5));
+			}
+			TH2F & graphData = image[0];
+			graphData.SetXTitle("channel");
+			graphData.SetYTitle("QIE bin");
+
+			for (unsigned int ch = 0; ch < nChannels; ++ch)
+				for (unsigned int fBin = 0; fBin < nBins; ++fBin)
+					graphData.Fill(ch, fBin, group.charges[ch * nBins + fBin]);
+
+			std::stringstream ss;
+			ss << filename << "_MinCharge_" << name << ".png";
+
+			drawImage(graphData, ss.str(), 840, 369);
+		}
+		return filename;
+	}
+}
+HCAL_PYTHON_WRAPPER(HcalCalibrationQIEData,HcalCalibrationQIEData);
@@ -1,6 +1,6 @@
 #include "CondFormats/HcalObjects/interface/HcalChannelQuality.h"
 #include "CondCore/Utilities/interface/PayLoadInspector.h"
-#include "CondCore/Utilities/interface/InspectorPythonWrapper.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
 
 #include <string>
 #include <fstream>
@@ -12,16 +12,27 @@
 #include "DataFormats/HcalDetId/interface/HcalDetId.h"
 
 #include "TROOT.h"
-#include "TCanvas.h"
-#include "TStyle.h"
-#include "TColor.h"
-#include "TLine.h"
 
 
 //functions for correct representation of data in summary and plot:
 #include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
 using namespace HcalObjRepresent;
 
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalChannelStatus>{
+		static const unsigned int nValues = 1;
+		//status bits, exact as float up to bit 23
+		static float value(HcalChannelStatus const & item, unsigned int){
+			return item.getValue();
+		}
+		static std::string name(unsigned int){
+			return "ChannelStatus";
+		}
+	};
+}
+
 namespace cond {
 
 	template<>
@@ -71,11 +82,11 @@ namespace cond {
 		bitMap[8] = 19;
 
 		// get all containers with names
-		HcalChannelQuality::tAllContWithNames allContainers = object().getAllContainers();
+		ContainerView<HcalChannelQuality> allContainers(object());
 
 		// initializing iterators
-		HcalChannelQuality::tAllContWithNames::const_iterator iter;
-		std::vector<HcalChannelStatus>::const_iterator contIter;
+		ContainerView<HcalChannelQuality>::const_iterator iter;
+		ContainerView<HcalChannelQuality>::Span::const_iterator contIter;
 		ss << "Total HCAL containers: " << allContainers.size() << std::endl;
 
 		//run trough all pair containers, print error values if any.
@@ -98,112 +109,62 @@ namespace cond {
 		return ss.str();
 	}
 
+	class HcalChannelQualityDataRepr: public ADataRepr
+	{
+	public:
+		HcalChannelQualityDataRepr(unsigned int total, ContainerView<HcalChannelQuality> const & allCont)
+			:ADataRepr(total), allContainers(allCont){}
+
+	protected:
+		ContainerView<HcalChannelQuality> allContainers;
+
+		//1+log2(status) of every channel with status bits set
+		void doFillIn(std::vector<EtaPhiGrid> &grids){
+			//ITERATORS AND VALUES:
+			ContainerView<HcalChannelQuality>::const_iterator iter;
+			ContainerView<HcalChannelQuality>::Span::const_iterator contIter;
+			uint32_t channelBits = 0;
+
+			//run trough all pair containers
+			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
+				for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
+					channelBits = (uint32_t)(*contIter).getValue();
+					if (channelBits == 0)
+						continue;
+					if (!setCell((uint32_t)(*contIter).rawId()))
+						continue;
+
+					//FILLING GOES HERE:
+					grids[0].fill(depth, ieta, iphi, log2(1.*channelBits)+1);
+				}
+			}
+		}
+	};
+
 	template<>
 	std::string PayLoadInspector<HcalChannelQuality>::plot(std::string const & filename,//
 		std::string const &,
 		std::vector<int> const&,
 		std::vector<float> const& ) const 
 	{
-		std::vector<TH2F> graphData;
-		setup(graphData, "ChannelStatus"); 
-
-		std::stringstream x;
-		// Change the titles of each individual histogram
-		for (unsigned int d=0;d < graphData.size();++d){
-			graphData[d].Reset();
-			x << "1+log2(status) for HCAL depth " << d+1;
-
-			//BUG CAN BE HERE:
-			//if (ChannelStatus->depth[d]) 
-			graphData[d].SetTitle(x.str().c_str());  // replace "setTitle" with "SetTitle", since you are using TH2F objects instead of MonitorElements
-			x.str("");
-		}
-
-		HcalDetId hcal_id;
-		int ieta, depth, iphi, channelBits;
-		double logstatus;
-
-		//main loop
-		// get all containers with names
-		HcalChannelQuality::tAllContWithNames allContainers = object().getAllContainers();
-
-		// initializing iterators
-		HcalChannelQuality::tAllContWithNames::const_iterator iter;
-		std::vector<HcalChannelStatus>::const_iterator contIter;
-
-		//run trough all pair containers
-		for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
-			for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
-				hcal_id = HcalDetId((uint32_t)(*contIter).rawId());
-
-				channelBits = (uint32_t)(*contIter).getValue();
-				if (channelBits == 0) 
-					continue;
-
-				depth = hcal_id.depth();
-				if (depth<1 || depth>4) 
-					continue;
-
-				ieta=hcal_id.ieta();
-				iphi=hcal_id.iphi();
-
-				if (hcal_id.subdet() == HcalForward)
-					ieta>0 ? ++ieta : --ieta;
-
-				logstatus = log2(1.*channelBits)+1;
-				//FILLING GOES HERE:
-				graphData[depth-1].Fill(ieta,iphi,logstatus);
-
-				//FOR DEBUGGING:
-				//std::cout << "ieta: " << ieta << "; iphi: " << iphi << "; logstatus: " << logstatus << "; channelBits: " << channelBits<< std::endl;
-			}
-		}
-		FillUnphysicalHEHFBins(graphData);
-
-
-
-		//Drawing...
-		// use David's palette
-		gStyle->SetPalette(1);
-		const Int_t NCont = 999;
-		gStyle->SetNumberContours(NCont);
-		TCanvas canvas("CC map","CC map",840,369*4);
-
-		TPad pad1("pad1","pad1", 0.0, 0.75, 1.0, 1.0);
-		pad1.Draw();
-		TPad pad2("pad2","pad2", 0.0, 0.5, 1.0, 0.75);
-		pad2.Draw();
-		TPad pad3("pad3","pad3", 0.0, 0.25, 1.0, 0.5);
-		pad3.Draw();
-		TPad pad4("pad4","pad4", 0.0, 0.0, 1.0, 0.25);
-		pad4.Draw();
-
-
-		pad1.cd();
-		graphData[0].SetStats(0);
-		graphData[0].Draw("colz");
-
-		pad2.cd();
-		graphData[1].SetStats(0);
-		graphData[1].Draw("colz");
-
-		pad3.cd();
-		graphData[2].SetStats(0);
-		graphData[2].Draw("colz");
-
-		pad4.cd();
-		graphData[3].SetStats(0);
-		graphData[3].Draw("colz");
-
-
-		std::stringstream ss;
-		ss <<filename << ".png";
-
-		canvas.SaveAs((ss.str()).c_str());
-
-		return (ss.str()).c_str();
+		//create object helper for making plots;
+		HcalChannelQualityDataRepr datarepr(1, ContainerView<HcalChannelQuality>(object()));
+
+		datarepr.nr = 0;
+		datarepr.id = 0;
+		datarepr.rootname.str("ChannelStatus");
+		datarepr.plotname.str("1+log2(status)");
+		datarepr.filename.str("");
+		datarepr.filename << filename;
+
+		std::vector< std::vector<TH2F> > graphDataVec(1);
+		datarepr.addImage(graphDataVec[0]);
+
+		//MAIN FUNCTION:
+		datarepr.fillImages(graphDataVec);
+		return filename + ".png";
 	}
 
 
 }
-PYTHON_WRAPPER(HcalChannelQuality,HcalChannelQuality);
+HCAL_PYTHON_WRAPPER(HcalChannelQuality,HcalChannelQuality);
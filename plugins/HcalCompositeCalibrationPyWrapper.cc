@@ -0,0 +1,99 @@
+#include "CondFormats/HcalObjects/interface/HcalGains.h"
+#include "CondFormats/HcalObjects/interface/HcalRespCorrs.h"
+#include "CondFormats/HcalObjects/interface/HcalQIEData.h"
+#include "CondFormats/HcalObjects/interface/HcalPFCorrs.h"
+#include "CondFormats/HcalObjects/interface/HcalTimeCorrs.h"
+
+#include "CondCore/Utilities/interface/PayLoadInspector.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
+#include "CondCore/HcalPlugins/interface/HcalCompositeCalibration.h"
+
+#include <string>
+#include <vector>
+
+#include <boost/python.hpp>
+#include <boost/shared_ptr.hpp>
+
+// Python module joining payloads of other HCAL modules, whose Object classes are used as arguments:
+//   CompositeCalibration(gains, respCorrs, qieData, pfCorrs=None, timeCorrs=None)
+// Modules of the inputs (pluginHcalGainsPyInterface, ...) must be imported first.
+using namespace HcalObjRepresent;
+
+namespace {
+	template<class T>
+	T const * optionalPayload(boost::python::object const & inspector){
+		if (inspector.ptr() == Py_None)
+			return 0;
+		cond::PayLoadInspector<T> const & payload = boost::python::extract<cond::PayLoadInspector<T> const &>(inspector);
+		return &payload.object();
+	}
+
+	boost::shared_ptr<CompositeCalibration> makeComposite(cond::PayLoadInspector<HcalGains> const & gains,
+		cond::PayLoadInspector<HcalRespCorrs> const & respCorrs, cond::PayLoadInspector<HcalQIEData> const & qie,
+		boost::python::object const & pfCorrs, boost::python::object const & timeCorrs){
+		HcalPFCorrs const * pf = optionalPayload<HcalPFCorrs>(pfCorrs);
+		HcalTimeCorrs const * time = optionalPayload<HcalTimeCorrs>(timeCorrs);
+		ReleaseGIL nogil;
+		return boost::shared_ptr<CompositeCalibration>(
+			new CompositeCalibration(gains.object(), respCorrs.object(), qie.object(), pf, time));
+	}
+
+	std::string summary(CompositeCalibration const & self){
+		ReleaseGIL nogil;
+		return self.summary();
+	}
+
+	std::string plot(CompositeCalibration const & self, std::string const & filename){
+		ReleaseGIL nogil;
+		BoundedMemoryScope memory;
+		return self.plot(filename);
+	}
+
+	std::vector<float> values(CompositeCalibration const & self, std::vector<int> const & rawIds){
+		std::vector<float> result;
+		ReleaseGIL nogil;
+		self.values(rawIds, result);
+		return result;
+	}
+
+	std::vector<std::string> columnNames(CompositeCalibration const &){
+		std::vector<std::string> names;
+		for (unsigned int c = 0; c < CompositeCalibration::nColumns; ++c)
+			names.push_back(CompositeCalibration::columnName(c));
+		return names;
+	}
+
+	// raw ids of all cells, in the order of column()
+	std::vector<int> rawIds(CompositeCalibration const &){
+		std::vector<int> ids;
+		std::vector<HcalDetId> const & detIds = ChannelIndex::detIds();
+		for (unsigned int slot = 0; slot < detIds.size(); ++slot)
+			ids.push_back((int)detIds[slot].rawId());
+		return ids;
+	}
+
+	std::vector<float> columnValues(CompositeCalibration const & self, unsigned int c){
+		return self.column(c);
+	}
+}
+
+BOOST_PYTHON_MODULE(pluginHcalCompositeCalibrationPyInterface) {
+	using namespace boost::python;
+	def("setBoundedMemory",&HcalObjRepresent::setBoundedMemory);
+	def("setProfiles",&HcalObjRepresent::setProfiles);
+	def("setDistributions",&HcalObjRepresent::setDistributions);
+	def("setDistributionBinning",&HcalObjRepresent::setDistributionBinning);
+	def("memoryReport",&HcalObjRepresent::BoundedMemoryScope::lastMemoryReport);
+	class_<CompositeCalibration, boost::shared_ptr<CompositeCalibration>, boost::noncopyable>("CompositeCalibration", no_init)
+		//optional payloads may be given alone, e.g. CompositeCalibration(g, r, q, timeCorrs=t)
+		.def("__init__", make_constructor(&makeComposite, default_call_policies(),
+			(arg("gains"), arg("respCorrs"), arg("qieData"), arg("pfCorrs")=object(), arg("timeCorrs")=object())))
+		.def("summary",&summary)
+		.def("plot",&plot)
+		.def("values",&values)
+		.def("valueNames",&columnNames)
+		.def("rawIds",&rawIds)
+		.def("column",&columnValues)
+		.def("nComplete",&CompositeCalibration::nComplete)
+		;
+}
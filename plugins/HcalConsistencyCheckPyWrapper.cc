@@ -0,0 +1,72 @@
+#include "CondFormats/HcalObjects/interface/HcalGains.h"
+#include "CondFormats/HcalObjects/interface/HcalGainWidths.h"
+#include "CondFormats/HcalObjects/interface/HcalPedestals.h"
+#include "CondFormats/HcalObjects/interface/HcalPedestalWidths.h"
+#include "CondFormats/HcalObjects/interface/HcalQIEData.h"
+#include "CondFormats/HcalObjects/interface/HcalChannelQuality.h"
+
+#include "CondCore/Utilities/interface/PayLoadInspector.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
+#include "CondCore/HcalPlugins/interface/HcalConsistencyCheck.h"
+
+#include <string>
+#include <vector>
+
+#include <boost/python.hpp>
+
+// Python module checking payloads of other HCAL modules against each other:
+//   check = ConsistencyCheck(); check.add(gains); check.add(gainWidths); ...; check.run()
+// Modules of the inputs (pluginHcalGainsPyInterface, ...) must be imported first.
+using namespace HcalObjRepresent;
+
+namespace {
+	template<class T>
+	void add(ConsistencyCheck & self, cond::PayLoadInspector<T> const & inspector){
+		ReleaseGIL nogil;
+		self.add(inspector.object());
+	}
+
+	void run(ConsistencyCheck & self){
+		ReleaseGIL nogil;
+		self.run();
+	}
+
+	std::string plot(ConsistencyCheck const & self, std::string const & filename){
+		ReleaseGIL nogil;
+		BoundedMemoryScope memory;
+		return self.plot(filename);
+	}
+
+	std::vector<std::string> ruleNames(){
+		std::vector<std::string> names;
+		for (unsigned int rule = 0; rule < ConsistencyCheck::nRules; ++rule)
+			names.push_back(ConsistencyCheck::ruleName(rule));
+		return names;
+	}
+}
+
+BOOST_PYTHON_MODULE(pluginHcalConsistencyCheckPyInterface) {
+	using namespace boost::python;
+	def("setBoundedMemory",&HcalObjRepresent::setBoundedMemory);
+	def("setProfiles",&HcalObjRepresent::setProfiles);
+	def("setDistributions",&HcalObjRepresent::setDistributions);
+	def("setDistributionBinning",&HcalObjRepresent::setDistributionBinning);
+	def("memoryReport",&HcalObjRepresent::BoundedMemoryScope::lastMemoryReport);
+	//rule numbers of count() and flagged()
+	def("ruleNames",&ruleNames);
+	class_<ConsistencyCheck, boost::noncopyable>("ConsistencyCheck", init<>())
+		.def("add",&add<HcalGains>)
+		.def("add",&add<HcalGainWidths>)
+		.def("add",&add<HcalPedestals>)
+		.def("add",&add<HcalPedestalWidths>)
+		.def("add",&add<HcalQIEData>)
+		.def("add",&add<HcalChannelQuality>)
+		.def("setDefaultGain",&ConsistencyCheck::setDefaultGain)
+		.def("setDefaultQIESlope",&ConsistencyCheck::setDefaultQIESlope)
+		.def("run",&run)
+		.def("count",&ConsistencyCheck::count)
+		.def("flagged",&ConsistencyCheck::flagged)
+		.def("summary",&ConsistencyCheck::summary)
+		.def("plot",&plot)
+		;
+}
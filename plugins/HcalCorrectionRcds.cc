@@ -0,0 +1,17 @@
+//registration of HCAL other per-channel corrections records, one plugin library per family of records;
+//IOVs with the same payload token share one object through PayloadCache
+
+#include "CondCore/HcalPlugins/interface/HcalCachedDataProxy.h"
+#include "CondFormats/HcalObjects/interface/HcalLUTCorrs.h"
+#include "CondFormats/HcalObjects/interface/HcalPFCorrs.h"
+#include "CondFormats/HcalObjects/interface/HcalTimeCorrs.h"
+#include "CondFormats/HcalObjects/interface/HcalValidationCorrs.h"
+#include "CondFormats/DataRecord/interface/HcalLUTCorrsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalPFCorrsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalTimeCorrsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalValidationCorrsRcd.h"
+
+REGISTER_CACHED_PLUGIN(HcalLUTCorrsRcd,HcalLUTCorrs);
+REGISTER_CACHED_PLUGIN(HcalPFCorrsRcd,HcalPFCorrs);
+REGISTER_CACHED_PLUGIN(HcalTimeCorrsRcd,HcalTimeCorrs);
+REGISTER_CACHED_PLUGIN(HcalValidationCorrsRcd,HcalValidationCorrs);
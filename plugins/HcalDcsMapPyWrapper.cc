@@ -0,0 +1,222 @@
+#include "CondFormats/HcalObjects/interface/HcalDcsMap.h"
+
+#include "CondCore/Utilities/interface/PayLoadInspector.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "DataFormats/DetId/interface/DetId.h"
+#include "DataFormats/HcalDetId/interface/HcalDetId.h"
+#include "DataFormats/HcalDetId/interface/HcalDcsDetId.h"
+
+namespace {
+	typedef std::pair<uint32_t, uint32_t> tIdPair;
+
+	// Both directions of the DCS map as sorted flat arrays of (key, value) raw ids.
+	// Every lookup is a binary search, so a batch of n ids costs O(n log N).
+	class DcsIndex
+	{
+	public:
+		explicit DcsIndex(HcalDcsMap const & map){
+			for (HcalDcsMap::const_iterator iter = map.beginById(); iter != map.endById(); ++iter){
+				uint32_t detId = iter.getHcalDetId().rawId();
+				uint32_t dcsId = iter.getHcalDcsDetId().rawId();
+				m_byDetId.push_back(tIdPair(detId, dcsId));
+				m_byDcsId.push_back(tIdPair(dcsId, detId));
+			}
+			std::sort(m_byDetId.begin(), m_byDetId.end());
+			std::sort(m_byDcsId.begin(), m_byDcsId.end());
+		}
+
+		// Batch lookups, both return flat list of (query, match) raw id pairs.
+		// If type is not 0, only DCS ids of that HcalDcsDetId::DcsType are kept.
+		std::vector<int> dcsIdsOf(std::vector<int> const & detIds, int type) const {
+			std::vector<int> result;
+			lookup(m_byDetId, detIds, type, true, result);
+			return result;
+		}
+
+		std::vector<int> detIdsOf(std::vector<int> const & dcsIds) const {
+			std::vector<int> result;
+			lookup(m_byDcsId, dcsIds, 0, false, result);
+			return result;
+		}
+
+		// entries per DCS type, subdetector, ring and slice
+		std::string summary() const;
+
+	private:
+		std::vector<tIdPair> m_byDetId;
+		std::vector<tIdPair> m_byDcsId;
+
+		// For every id in ids appends (id, match) to result for each match in index.
+		static void lookup(std::vector<tIdPair> const & index, std::vector<int> const & ids, int type, bool dcsIsValue, std::vector<int> &result){
+			std::vector<tIdPair>::const_iterator first, last;
+			for (std::vector<int>::const_iterator id = ids.begin(); id != ids.end(); ++id){
+				first = std::lower_bound(index.begin(), index.end(), tIdPair((uint32_t)(*id), 0));
+				for (last = first; last != index.end() && last->first == (uint32_t)(*id); ++last){
+					uint32_t dcsId = dcsIsValue ? last->second : last->first;
+					if (type != 0 && HcalDcsDetId(dcsId).type() != type)
+						continue;
+					result.push_back(*id);
+					result.push_back((int)last->second);
+				}
+			}
+		}
+	};
+
+	std::string dcsSubdetName(int subdet){
+		switch(subdet){
+			case HcalDcsBarrel: return "HB";
+			case HcalDcsEndcap: return "HE";
+			case HcalDcsOuter: return "HO";
+			case HcalDcsForward: return "HF";
+			default: return "Other";
+		}
+	}
+
+	std::string DcsIndex::summary() const {
+		std::stringstream ss;
+		std::vector<tIdPair> const & byDcsId = m_byDcsId;
+
+		//counts per subdetector, per (subdetector, ring) and per (subdetector, ring, slice)
+		typedef std::map<int, unsigned int> tCounts;
+		std::map<int, unsigned int> perSubdet;
+		std::map<std::pair<int, int>, unsigned int> perRing;
+		std::map<std::pair<int, int>, tCounts> perSlice;
+		tCounts perType;
+
+		unsigned int dcsChannels = 0;
+		std::vector<tIdPair>::const_iterator iter;
+		for (iter = byDcsId.begin(); iter != byDcsId.end(); ++iter){
+			HcalDcsDetId dcsId(iter->first);
+			std::pair<int, int> ring(dcsId.subdet(), dcsId.ring());
+			++perSubdet[dcsId.subdet()];
+			++perRing[ring];
+			++perSlice[ring][dcsId.slice()];
+			++perType[dcsId.type()];
+			if (iter == byDcsId.begin() || (iter - 1)->first != iter->first)
+				++dcsChannels;
+		}
+
+		unsigned int detChannels = 0;
+		std::vector<tIdPair> const & byDetId = m_byDetId;
+		for (iter = byDetId.begin(); iter != byDetId.end(); ++iter)
+			if (iter == byDetId.begin() || (iter - 1)->first != iter->first)
+				++detChannels;
+
+		ss << "Total DCS map entries: " << byDcsId.size() << std::endl;
+		ss << "Distinct DCS channels: " << dcsChannels << ";    Distinct HCAL cells: " << detChannels << std::endl;
+
+		ss << "---------------------------------------------" << std::endl;
+		for (tCounts::const_iterator type = perType.begin(); type != perType.end(); ++type)
+			ss << "    Type " << HcalDcsDetId::typeString((HcalDcsDetId::DcsType)type->first) << ": " << type->second << std::endl;
+
+		for (tCounts::const_iterator subdet = perSubdet.begin(); subdet != perSubdet.end(); ++subdet){
+			ss << "---------------------------------------------" << std::endl;
+			ss << "Detector: " << dcsSubdetName(subdet->first) << ";    Total values: "<< subdet->second << std::endl;
+			std::map<std::pair<int, int>, unsigned int>::const_iterator ring;
+			for (ring = perRing.begin(); ring != perRing.end(); ++ring){
+				if (ring->first.first != subdet->first)
+					continue;
+				ss << "    Ring " << ring->first.second << ": " << ring->second << ";    Slices:";
+				tCounts const & slices = perSlice[ring->first];
+				for (tCounts::const_iterator slice = slices.begin(); slice != slices.end(); ++slice)
+					ss << " " << slice->first << "(" << slice->second << ")";
+				ss << std::endl;
+			}
+		}
+		return ss.str();
+	}
+}
+
+namespace HcalObjRepresent{
+	// A channel of the DCS map has a list of DCS ids, not values: values() gives no columns,
+	// DcsIndex has the batch lookups of this payload.
+	template<>
+	struct ChannelLookup<HcalDcsMap>{
+		static unsigned int nValues(){return 0;}
+		static std::string name(unsigned int){throw("Trying to access not existing value!");}
+		static bool get(HcalDcsMap const &, DetId, float *){return false;}
+	};
+
+	// channels of the map, each once (a channel has several DCS ids)
+	template<>
+	struct PayloadChannels<HcalDcsMap>{
+		static std::vector<DetId> get(HcalDcsMap const & map){
+			std::vector<uint32_t> rawIds;
+			for (HcalDcsMap::const_iterator iter = map.beginById(); iter != map.endById(); ++iter)
+				rawIds.push_back(iter.getHcalDetId().rawId());
+			std::sort(rawIds.begin(), rawIds.end());
+			rawIds.erase(std::unique(rawIds.begin(), rawIds.end()), rawIds.end());
+			return std::vector<DetId>(rawIds.begin(), rawIds.end());
+		}
+	};
+}
+
+namespace cond {
+	template<>
+	class ValueExtractor<HcalDcsMap>: public  BaseValueExtractor<HcalDcsMap> {
+	public:
+		typedef HcalDcsMap Class;
+		typedef ExtractWhat<Class> What;
+		static What what() { return What();}
+
+		ValueExtractor(){}
+
+		ValueExtractor(What const & what)
+		{
+			// here one can make stuff really complicated...
+		}
+
+		void compute(Class const & it){
+		}
+	private:
+
+	};
+
+	template<>
+	std::string PayLoadInspector<HcalDcsMap>::summary() const {
+		return DcsIndex(object()).summary();
+	}
+}
+
+namespace {
+	// index = dcsIndex(object) builds the index once; index.dcsIdsOf([detIds], dcsType or 0),
+	// index.detIdsOf([dcsIds]) and index.summary() reuse it
+	DcsIndex inspectorDcsIndex(cond::PayLoadInspector<HcalDcsMap> const & self){
+		HcalObjRepresent::ReleaseGIL nogil;
+		return DcsIndex(self.object());
+	}
+
+	std::vector<int> indexDcsIdsOf(DcsIndex const & self, std::vector<int> const & detIds, int type){
+		HcalObjRepresent::ReleaseGIL nogil;
+		return self.dcsIdsOf(detIds, type);
+	}
+
+	std::vector<int> indexDetIdsOf(DcsIndex const & self, std::vector<int> const & dcsIds){
+		HcalObjRepresent::ReleaseGIL nogil;
+		return self.detIdsOf(dcsIds);
+	}
+}
+
+namespace HcalObjRepresent{
+	template<>
+	struct PythonExtras<HcalDcsMap>
+	{
+		static void define(){
+			using namespace boost::python;
+			class_<DcsIndex>("DcsIndex", no_init)
+				.def("dcsIdsOf", &indexDcsIdsOf)
+				.def("detIdsOf", &indexDetIdsOf)
+				.def("summary", &DcsIndex::summary)
+				;
+			def("dcsIndex", &inspectorDcsIndex);
+		}
+	};
+}
+HCAL_PYTHON_WRAPPER(HcalDcsMap,HcalDcsMap);
@@ -0,0 +1,78 @@
+#include "CondFormats/HcalObjects/interface/HcalFlagHFDigiTimeParams.h"
+#include "CondFormats/HcalObjects/interface/HcalFlagHFDigiTimeParam.h"
+
+#include "CondCore/Utilities/interface/PayLoadInspector.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
+
+#include <string>
+#include <vector>
+
+//summary, plot and value extraction are generated from the field descriptor:
+#include "CondCore/HcalPlugins/interface/HcalGenericRepresent.h"
+using namespace HcalObjRepresent;
+
+namespace HcalObjRepresent{
+	// HFdigiflagCoefficients() has a variable length per channel, so it is not mapped
+	template<>
+	struct FieldDescriptor<HcalFlagHFDigiTimeParam>{
+		static const unsigned int nValues = 4;
+		static float value(HcalFlagHFDigiTimeParam const & item, unsigned int i){
+			switch(i){
+				case 0: return item.HFdigiflagFirstSample();
+				case 1: return item.HFdigiflagSamplesToAdd();
+				case 2: return item.HFdigiflagExpectedPeak();
+				case 3: return item.HFdigiflagMinEThreshold();
+				default: throw("Trying to access not existing value!");
+			}
+		}
+		static std::string name(unsigned int i){
+			switch(i){
+				case 0: return "FirstSample";
+				case 1: return "SamplesToAdd";
+				case 2: return "ExpectedPeak";
+				case 3: return "MinEThreshold";
+				default: throw("Trying to access not existing value!");
+			}
+		}
+	};
+}
+
+namespace cond {
+	template<>
+	class ValueExtractor<HcalFlagHFDigiTimeParams>: public  BaseValueExtractor<HcalFlagHFDigiTimeParams> {
+	public:
+		typedef HcalFlagHFDigiTimeParams Class;
+		typedef ExtractWhat<Class> What;
+		static What what() { return What();}
+
+		ValueExtractor(){}
+
+		ValueExtractor(What const & what)
+		{
+			// here one can make stuff really complicated...
+		}
+
+		void compute(Class const & it){
+			std::vector<float> res;
+			genericExtract(it, res);
+			swap(res);
+		}
+	private:
+
+	};
+
+	template<>
+	std::string PayLoadInspector<HcalFlagHFDigiTimeParams>::summary() const {
+		return genericSummary(object());
+	}
+
+	template<>
+	std::string PayLoadInspector<HcalFlagHFDigiTimeParams>::plot(std::string const & filename,
+		std::string const &,
+		std::vector<int> const&,
+		std::vector<float> const& ) const 
+	{
+		return genericPlot(object(), filename);
+	}
+}
+HCAL_PYTHON_WRAPPER(HcalFlagHFDigiTimeParams,HcalFlagHFDigiTimeParams);
@@ -0,0 +1,14 @@
+//registration of HCAL gains and response corrections records, one plugin library per family of records;
+//IOVs with the same payload token share one object through PayloadCache
+
+#include "CondCore/HcalPlugins/interface/HcalCachedDataProxy.h"
+#include "CondFormats/HcalObjects/interface/HcalGains.h"
+#include "CondFormats/HcalObjects/interface/HcalGainWidths.h"
+#include "CondFormats/HcalObjects/interface/HcalRespCorrs.h"
+#include "CondFormats/DataRecord/interface/HcalGainsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalGainWidthsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalRespCorrsRcd.h"
+
+REGISTER_CACHED_PLUGIN(HcalGainsRcd,HcalGains);
+REGISTER_CACHED_PLUGIN(HcalGainWidthsRcd,HcalGainWidths);
+REGISTER_CACHED_PLUGIN(HcalRespCorrsRcd,HcalRespCorrs);
@@ -2,7 +2,7 @@
 #include "CondFormats/HcalObjects/interface/HcalGainWidth.h"
 
 #include "CondCore/Utilities/interface/PayLoadInspector.h"
-#include "CondCore/Utilities/interface/InspectorPythonWrapper.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
 
 #include <string>
 #include <fstream>
@@ -14,16 +14,26 @@
 #include "DataFormats/HcalDetId/interface/HcalDetId.h"
 
 #include "TROOT.h"
-#include "TCanvas.h"
-#include "TStyle.h"
-#include "TColor.h"
-#include "TLine.h"
 
 #include "math.h"
 //functions for correct representation of data in summary and plot:
 #include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
 using namespace HcalObjRepresent;
 
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalGainWidth>{
+		static const unsigned int nValues = 4;
+		static float value(HcalGainWidth const & item, unsigned int i){
+			return item.getValue(i);
+		}
+		static std::string name(unsigned int i){
+			return indexedName("GainWidth", i);
+		}
+	};
+}
+
 namespace cond {
 	template<>
 	class ValueExtractor<HcalGainWidths>: public  BaseValueExtractor<HcalGainWidths> {
@@ -48,42 +58,32 @@ namespace cond {
 	class HcalGainWidthsDataRepr: public ADataRepr
 	{
 	public:
-		HcalGainWidthsDataRepr(unsigned int total, HcalGainWidths::tAllContWithNames const & allCont)
+		HcalGainWidthsDataRepr(unsigned int total, ContainerView<HcalGainWidths> const & allCont)
 			:ADataRepr(total), allContainers(allCont){}
 
 
 
 	protected:
-		HcalGainWidths::tAllContWithNames allContainers;
+		ContainerView<HcalGainWidths> allContainers;
 
-		void doFillIn(std::vector<TH2F> &graphData){
+		void doFillIn(std::vector<EtaPhiGrid> &grids){
 			//ITERATORS AND VALUES:
-			HcalGainWidths::tAllContWithNames::const_iterator iter;
-			std::vector<HcalGainWidth>::const_iterator contIter;
+			ContainerView<HcalGainWidths>::const_iterator iter;
+			ContainerView<HcalGainWidths>::Span::const_iterator contIter;
 			float value = 0.0;
 
 			//run trough all pair containers
 			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
 				//Run trough all values:
 				for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
-					hcal_id = HcalDetId((uint32_t)(*contIter).rawId());
-
-					depth = hcal_id.depth();
-					if (depth<1 || depth>4) 
+					if (!setCell((uint32_t)(*contIter).rawId()))
 						continue;
 
-					ieta=hcal_id.ieta();
-					iphi=hcal_id.iphi();
-
-					if (hcal_id.subdet() == HcalForward)
-						ieta>0 ? ++ieta : --ieta;
-
-					//GET VALUE:
-					value = (*contIter).getValue(id);
-					//logstatus = log2(1.*channelBits)+1;
-
-					//FILLING GOES HERE:
-					graphData[depth-1].Fill(ieta,iphi, value);	
+					//GET VALUES (all values of channel are loaded once):
+					for (unsigned int i = 0; i < grids.size(); ++i){
+						value = (*contIter).getValue(i);
+						grids[i].fill(depth, ieta, iphi, value);
+					}
 				}
 			}
 		}
@@ -94,11 +94,11 @@ namespace cond {
 		std::stringstream ss;
 		unsigned int totalValues = 4;
 		// get all containers with names
-		HcalGainWidths::tAllContWithNames allContainers = object().getAllContainers();
+		ContainerView<HcalGainWidths> allContainers(object());
 
 		// initializing iterators
-		HcalGainWidths::tAllContWithNames::const_iterator iter;
-		std::vector<HcalGainWidth>::const_iterator contIter;
+		ContainerView<HcalGainWidths>::const_iterator iter;
+		ContainerView<HcalGainWidths>::Span::const_iterator contIter;
 
 		ss << "Total HCAL containers: " << allContainers.size() << std::endl;
 
@@ -162,7 +162,7 @@ namespace cond {
 		unsigned int numOfValues = 4;
 
 		//create object helper for making plots;
-		HcalGainWidthsDataRepr datarepr(numOfValues, object().getAllContainers());
+		HcalGainWidthsDataRepr datarepr(numOfValues, ContainerView<HcalGainWidths>(object()));
 
 		datarepr.nr = 0;
 		datarepr.id = 0;
@@ -178,13 +178,14 @@ namespace cond {
 		//create images:
 		for (imageIter = graphDataVec.begin(); imageIter != graphDataVec.end(); ++imageIter){
 
-			//MAIN FUNCTION:
-			datarepr.fillOneGain((*imageIter));
+			datarepr.addImage((*imageIter));
 
 			++(datarepr.nr);
 			++(datarepr.id);
 		}
+		//MAIN FUNCTION:
+		datarepr.fillImages(graphDataVec);
 		return filename;
 	}
 }
-PYTHON_WRAPPER(HcalGainWidths,HcalGainWidths);
\ No newline at end of file
+HCAL_PYTHON_WRAPPER(HcalGainWidths,HcalGainWidths);
\ No newline at end of file
@@ -1,7 +1,7 @@
 #include "CondFormats/HcalObjects/interface/HcalGains.h"
 
 #include "CondCore/Utilities/interface/PayLoadInspector.h"
-#include "CondCore/Utilities/interface/InspectorPythonWrapper.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
 
 #include <string>
 #include <fstream>
@@ -13,16 +13,26 @@
 #include "DataFormats/HcalDetId/interface/HcalDetId.h"
 
 #include "TROOT.h"
-#include "TCanvas.h"
-#include "TStyle.h"
-#include "TColor.h"
-#include "TLine.h"
 
 #include "math.h"
 //functions for correct representation of data in summary and plot:
 #include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
 using namespace HcalObjRepresent;
 
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalGain>{
+		static const unsigned int nValues = 4;
+		static float value(HcalGain const & item, unsigned int i){
+			return item.getValue(i);
+		}
+		static std::string name(unsigned int i){
+			return indexedName("Gain", i);
+		}
+	};
+}
+
 namespace cond {
 
 	template<>
@@ -45,17 +55,48 @@ namespace cond {
 
 	};
 
+	class HcalGainsDataRepr: public ADataRepr
+	{
+	public:
+		HcalGainsDataRepr(unsigned int total, ContainerView<HcalGains> const & allCont)
+			:ADataRepr(total), allContainers(allCont){}
+
+	protected:
+		ContainerView<HcalGains> allContainers;
+
+		void doFillIn(std::vector<EtaPhiGrid> &grids){
+			//ITERATORS AND VALUES:
+			ContainerView<HcalGains>::const_iterator iter;
+			ContainerView<HcalGains>::Span::const_iterator contIter;
+			float value = 0.0;
+
+			//run trough all pair containers
+			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
+				//Run trough all values:
+				for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
+					if (!setCell((uint32_t)(*contIter).rawId()))
+						continue;
+
+					//GET VALUES (all values of channel are loaded once):
+					for (unsigned int i = 0; i < grids.size(); ++i){
+						value = (*contIter).getValue(i);
+						grids[i].fill(depth, ieta, iphi, value);
+					}
+				}
+			}
+		}
+	};
 
 	template<>
 	std::string PayLoadInspector<HcalGains>::summary() const {
 		std::stringstream ss;
 
 		// get all containers with names
-		HcalGains::tAllContWithNames allContainers = object().getAllContainers();
+		ContainerView<HcalGains> allContainers(object());
 
 		// initializing iterators
-		HcalGains::tAllContWithNames::const_iterator iter;
-		std::vector<HcalGain>::const_iterator contIter;
+		ContainerView<HcalGains>::const_iterator iter;
+		ContainerView<HcalGains>::Span::const_iterator contIter;
 
 		ss << "Total HCAL containers: " << allContainers.size() << std::endl;
 
@@ -110,74 +151,39 @@ namespace cond {
 		return ss.str();
 	}
 
-	void draw(std::vector<TH2F> &graphData, std::string filename) {
-		//Drawing...
-		// use David's palette
-		gStyle->SetPalette(1);
-		const Int_t NCont = 999;
-		gStyle->SetNumberContours(NCont);
-		TCanvas canvas("CC map","CC map",840,369*4);
-
-		TPad pad1("pad1","pad1", 0.0, 0.75, 1.0, 1.0);
-		pad1.Draw();
-		TPad pad2("pad2","pad2", 0.0, 0.5, 1.0, 0.75);
-		pad2.Draw();
-		TPad pad3("pad3","pad3", 0.0, 0.25, 1.0, 0.5);
-		pad3.Draw();
-		TPad pad4("pad4","pad4", 0.0, 0.0, 1.0, 0.25);
-		pad4.Draw();
-
-
-		pad1.cd();
-		graphData[0].SetStats(0);
-		graphData[0].Draw("colz");
-
-		pad2.cd();
-		graphData[1].SetStats(0);
-		graphData[1].Draw("colz");
-
-		pad3.cd();
-		graphData[2].SetStats(0);
-		graphData[2].Draw("colz");
-
-		pad4.cd();
-		graphData[3].SetStats(0);
-		graphData[3].Draw("colz");
-
-		canvas.SaveAs(filename.c_str());
-	}
-
 	template<>
 	std::string PayLoadInspector<HcalGains>::plot(std::string const & filename,
 		std::string const &,
 		std::vector<int> const&,
 		std::vector<float> const& ) const 
 	{
-		 //void set(since, till, filename); {
+		//how much values are in container
 		unsigned int numOfValues = 4;
-		std::string plotname = "_Gain_";
-		//filename = filename + "_Gain";
 
+		//create object helper for making plots;
+		HcalGainsDataRepr datarepr(numOfValues, ContainerView<HcalGains>(object()));
+
+		datarepr.nr = 0;
+		datarepr.id = 0;
+		datarepr.rootname.str("_Gain_");
+		datarepr.plotname.str("Gain ");
+		datarepr.filename.str("");
+		datarepr.filename << filename << "_Gain_";
 
 		typedef std::vector<TH2F> graphData;
 		std::vector< graphData > graphDataVec(numOfValues);
-		std::vector< graphData >::iterator bigIter;
-
-		std::stringstream ss, plotname_i;
-		HcalGains::tAllContWithNames allContainers = object().getAllContainers();
-
-		int i = 0;
-		for (bigIter = graphDataVec.begin(); bigIter != graphDataVec.end(); ++bigIter){
-			plotname_i << plotname << i ;
-			ss << filename << "_Gain_"<<i<<".png";
-			fillOneGain((*bigIter), allContainers, plotname_i.str(), i);
-			FillUnphysicalHEHFBins(*bigIter);
-			draw((*bigIter), ss.str());
-			++i;
-			ss.str("");
-			plotname_i.str("");
+		std::vector< graphData >::iterator imageIter;
+
+		//create images:
+		for (imageIter = graphDataVec.begin(); imageIter != graphDataVec.end(); ++imageIter){
+			datarepr.addImage((*imageIter));
+
+			++(datarepr.nr);
+			++(datarepr.id);
 		}
+		//MAIN FUNCTION:
+		datarepr.fillImages(graphDataVec);
 		return filename;
 	}
 }
-PYTHON_WRAPPER(HcalGains,HcalGains);
\ No newline at end of file
+HCAL_PYTHON_WRAPPER(HcalGains,HcalGains);
\ No newline at end of file
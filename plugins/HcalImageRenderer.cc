@@ -0,0 +1,119 @@
+#include "CondCore/HcalPlugins/interface/HcalImageRenderer.h"
+
+#include "TCanvas.h"
+#include "TPad.h"
+#include "TStyle.h"
+
+//the only part of HcalPlugins which needs ROOT graphics
+namespace {
+	using namespace HcalObjRepresent;
+
+	// Own style with David's palette made current for rendering of one image,
+	// previous gStyle is restored on exit.
+	class RenderScope
+	{
+	public:
+		RenderScope():m_style("HcalObjRepresent", "HcalObjRepresent plots"), m_previous(gStyle){
+			// use David's palette
+			m_style.SetPalette(1);
+			const Int_t NCont = 999;
+			m_style.SetNumberContours(NCont);
+			m_style.cd();
+		}
+		~RenderScope(){
+			if (m_previous)
+				m_previous->cd();
+		}
+	private:
+		TStyle m_style;
+		TStyle * m_previous;
+	};
+
+	// Copies of the caller's histograms, made without gDirectory. A drawn object is marked for
+	// cleanup (kMustCleanup) and its destructor then walks the global cleanup list, so only these
+	// copies are drawn: they are destroyed before the call returns, still under RootLock.
+	template<class H>
+	class DrawnCopies
+	{
+	public:
+		explicit DrawnCopies(std::vector<H> const & histograms){
+			Bool_t status = TH1::AddDirectoryStatus();
+			TH1::AddDirectory(kFALSE);
+			m_copies.assign(histograms.begin(), histograms.end());
+			TH1::AddDirectory(status);
+		}
+		explicit DrawnCopies(H const & histogram){
+			Bool_t status = TH1::AddDirectoryStatus();
+			TH1::AddDirectory(kFALSE);
+			m_copies.assign(1, histogram);
+			TH1::AddDirectory(status);
+		}
+		H & operator[](unsigned int i){return m_copies[i];}
+		unsigned int size() const {return m_copies.size();}
+	private:
+		std::vector<H> m_copies;
+	};
+
+	class RootImageRenderer: public ImageRenderer
+	{
+	public:
+		void drawDepths(std::vector<TH2F> &graphData, std::string const & filename) {
+			RenderScope render;
+			//canvas name is unique per output file, canvases of other threads are never replaced
+			TCanvas canvas(("CC map " + filename).c_str(),"CC map",840,369*4);
+			DrawnCopies<TH2F> depths(graphData);
+
+			TPad pad1("pad1","pad1", 0.0, 0.75, 1.0, 1.0);
+			pad1.Draw();
+			TPad pad2("pad2","pad2", 0.0, 0.5, 1.0, 0.75);
+			pad2.Draw();
+			TPad pad3("pad3","pad3", 0.0, 0.25, 1.0, 0.5);
+			pad3.Draw();
+			TPad pad4("pad4","pad4", 0.0, 0.0, 1.0, 0.25);
+			pad4.Draw();
+
+
+			pad1.cd();
+			depths[0].SetStats(0);
+			depths[0].Draw("colz");
+
+			pad2.cd();
+			depths[1].SetStats(0);
+			depths[1].Draw("colz");
+
+			pad3.cd();
+			depths[2].SetStats(0);
+			depths[2].Draw("colz");
+
+			pad4.cd();
+			depths[3].SetStats(0);
+			depths[3].Draw("colz");
+
+			canvas.SaveAs(filename.c_str());
+		}
+
+		void drawImage(TH2F &image, std::string const & filename, int width, int height) {
+			RenderScope render;
+			TCanvas canvas(("CC map " + filename).c_str(),"CC map",width,height);
+			DrawnCopies<TH2F> images(image);
+			images[0].SetStats(0);
+			images[0].Draw("colz");
+			canvas.SaveAs(filename.c_str());
+		}
+
+		void drawHistograms(std::vector<TH1F> &histograms, std::string const & filename, std::string const & option) {
+			RenderScope render;
+			TCanvas canvas(("CC histograms " + filename).c_str(),"CC histograms",840,300*histograms.size());
+			canvas.Divide(1, histograms.size());
+			DrawnCopies<TH1F> copies(histograms);
+			for (unsigned int i = 0; i < copies.size(); ++i){
+				canvas.cd(i+1);
+				copies[i].SetStats(0);
+				copies[i].Draw(option.c_str());
+			}
+			canvas.SaveAs(filename.c_str());
+		}
+	};
+}
+
+DEFINE_EDM_PLUGIN(ImageRendererFactory, RootImageRenderer, "HcalRootImageRenderer");
@@ -2,7 +2,7 @@
 #include "CondFormats/HcalObjects/interface/HcalLutMetadatum.h"
 
 #include "CondCore/Utilities/interface/PayLoadInspector.h"
-#include "CondCore/Utilities/interface/InspectorPythonWrapper.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
 
 #include <string>
 #include <fstream>
@@ -14,16 +14,36 @@
 #include "DataFormats/HcalDetId/interface/HcalDetId.h"
 
 #include "TROOT.h"
-#include "TCanvas.h"
-#include "TStyle.h"
-#include "TColor.h"
-#include "TLine.h"
 
 #include "math.h"
 //functions for correct representation of data in summary and plot:
 #include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
 using namespace HcalObjRepresent;
 
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalLutMetadatum>{
+		static const unsigned int nValues = 3;
+		static float value(HcalLutMetadatum const & item, unsigned int i){
+			switch(i){
+				case 0: return item.getRCalib();
+				case 1: return item.getLutGranularity();
+				case 2: return item.getOutputLutThreshold();
+				default: throw("Trying to access not existing value!");
+			}
+		}
+		static std::string name(unsigned int i){
+			switch(i){
+				case 0: return "RCalib";
+				case 1: return "LutGranularity";
+				case 2: return "OutputLutThreshold";
+				default: throw("Trying to access not existing value!");
+			}
+		}
+	};
+}
+
 namespace cond {
 	template<>
 	class ValueExtractor<HcalLutMetadata>: public  BaseValueExtractor<HcalLutMetadata> {
@@ -48,56 +68,30 @@ namespace cond {
 	class HcalLutMetadataDataRepr: public ADataRepr
 	{
 	public:
-		HcalLutMetadataDataRepr(unsigned int total, HcalLutMetadata::tAllContWithNames const & allCont)
+		HcalLutMetadataDataRepr(unsigned int total, ContainerView<HcalLutMetadata> const & allCont)
 			:ADataRepr(total), allContainers(allCont){}
 
 
 
 	protected:
-		HcalLutMetadata::tAllContWithNames allContainers;
+		ContainerView<HcalLutMetadata> allContainers;
 
-		void doFillIn(std::vector<TH2F> &graphData){
+		void doFillIn(std::vector<EtaPhiGrid> &grids){
 			//ITERATORS AND VALUES:
-			HcalLutMetadata::tAllContWithNames::const_iterator iter;
-			std::vector<HcalLutMetadatum>::const_iterator contIter;
-			float value = 0.0;
+			ContainerView<HcalLutMetadata>::const_iterator iter;
+			ContainerView<HcalLutMetadata>::Span::const_iterator contIter;
 
 			//run trough all pair containers
 			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
 				//Run trough all values:
 				for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
-					hcal_id = HcalDetId((uint32_t)(*contIter).rawId());
-
-					depth = hcal_id.depth();
-					if (depth<1 || depth>4) 
+					if (!setCell((uint32_t)(*contIter).rawId()))
 						continue;
 
-					ieta=hcal_id.ieta();
-					iphi=hcal_id.iphi();
-
-					if (hcal_id.subdet() == HcalForward)
-						ieta>0 ? ++ieta : --ieta;
-
-					//GET VALUE:
-					switch(id){
-	case 0:
-		value = (*contIter).getRCalib();
-		break;
-	case 1:
-		value = (*contIter).getLutGranularity();
-		break;
-	case 2:
-		value = (*contIter).getOutputLutThreshold();
-		break;
-	default:
-		throw("Trying to access not existing value!");
-
-					}
-					//value = (*contIter).getValue(id);
-					//logstatus = log2(1.*channelBits)+1;
-
-					//FILLING GOES HERE:
-					graphData[depth-1].Fill(ieta,iphi, value);	
+					//GET VALUES (all values of channel are loaded once):
+					float values[3] = {(*contIter).getRCalib(), (float)(*contIter).getLutGranularity(), (float)(*contIter).getOutputLutThreshold()};
+					for (unsigned int i = 0; i < grids.size() && i < 3; ++i)
+						grids[i].fill(depth, ieta, iphi, values[i]);
 				}
 			}
 		}
@@ -110,11 +104,11 @@ namespace cond {
 		unsigned int totalValues = 3;
 
 		// get all containers with names
-		HcalLutMetadata::tAllContWithNames allContainers = object().getAllContainers();
+		ContainerView<HcalLutMetadata> allContainers(object());
 
 		// initializing iterators
-		HcalLutMetadata::tAllContWithNames::const_iterator iter;
-		std::vector<HcalLutMetadatum>::const_iterator contIter;
+		ContainerView<HcalLutMetadata>::const_iterator iter;
+		ContainerView<HcalLutMetadata>::Span::const_iterator contIter;
 
 		ss << "Total HCAL containers: " << allContainers.size() << std::endl;
 
@@ -207,7 +201,7 @@ namespace cond {
 		unsigned int numOfValues = 3;
 
 		//create object helper for making plots;
-		HcalLutMetadataDataRepr datarepr(numOfValues, object().getAllContainers());
+		HcalLutMetadataDataRepr datarepr(numOfValues, ContainerView<HcalLutMetadata>(object()));
 
 		datarepr.nr = 0;
 		datarepr.id = 0;
@@ -222,34 +216,46 @@ namespace cond {
 		//create images:
 		for (imageIter = graphDataVec.begin(); imageIter != graphDataVec.end(); ++imageIter){
 			switch(datarepr.id){
-	case 0:
-		datarepr.rootname.str("_RCalibrootvalue_");
-		datarepr.plotname.str("RCalib ");
-		datarepr.filename.str("");
-		datarepr.filename << filename << "_RCalib_";
-		break;
-	case 1:
-		datarepr.rootname.str("_LutGranularityrootvalue_");
-		datarepr.plotname.str("LutGranularity ");
-		datarepr.filename.str("");
-		datarepr.filename << filename << "_LutGranularity_";
-		break;
-	case 2:
-		datarepr.rootname.str("_OutputLutThresholdrootvalue_");
-		datarepr.plotname.str("OutputLutThreshold ");
-		datarepr.filename.str("");
-		datarepr.filename << filename << "_OutputLutThreshold_";
-		break;
-	default:
-		throw("Trying to access not existing value!");
+				case 0:
+					datarepr.rootname.str("_RCalibrootvalue_");
+					datarepr.plotname.str("RCalib ");
+					datarepr.filename.str("");
+					datarepr.filename << filename << "_RCalib_";
+					break;
+				case 1:
+					datarepr.rootname.str("_LutGranularityrootvalue_");
+					datarepr.plotname.str("LutGranularity ");
+					datarepr.filename.str("");
+					datarepr.filename << filename << "_LutGranularity_";
+					break;
+				case 2:
+					datarepr.rootname.str("_OutputLutThresholdrootvalue_");
+					datarepr.plotname.str("OutputLutThreshold ");
+					datarepr.filename.str("");
+					datarepr.filename << filename << "_OutputLutThreshold_";
+					break;
+				default:
+					throw("Trying to access not existing value!");
 			}
-			//MAIN FUNCTION:
-			datarepr.fillOneGain((*imageIter));
+			datarepr.addImage((*imageIter));
 
 			//++(datarepr.nr);
 			++(datarepr.id);
 		}
+		//MAIN FUNCTION:
+		datarepr.fillImages(graphDataVec);
 		return filename;
 	}
 }
-PYTHON_WRAPPER(HcalLutMetadata,HcalLutMetadata);
\ No newline at end of file
+namespace HcalObjRepresent{
+	//towers(object): values aggregated into trigger towers
+	template<>
+	struct PythonExtras<HcalLutMetadata>
+	{
+		static void define(){
+			defineTriggerTowers();
+			boost::python::def("towers", &inspectorTowers<HcalLutMetadata>);
+		}
+	};
+}
+HCAL_PYTHON_WRAPPER(HcalLutMetadata,HcalLutMetadata);
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "CondFormats/HcalObjects/interface/HcalMCParams.h"
+#include "CondFormats/HcalObjects/interface/HcalMCParam.h"
+
+#include "CondCore/Utilities/interface/PayLoadInspector.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
+
+#include <string>
+#include <vector>
+
+//summary, plot and value extraction are generated from the field descriptor:
+#include "CondCore/HcalPlugins/interface/HcalGenericRepresent.h"
+using namespace HcalObjRepresent;
+
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalMCParam>{
+		static const unsigned int nValues = 1;
+		static float value(HcalMCParam const & item, unsigned int i){
+			return item.signalShape();
+		}
+		static std::string name(unsigned int i){
+			return "SignalShape";
+		}
+	};
+}
+
+namespace cond {
+	template<>
+	class ValueExtractor<HcalMCParams>: public  BaseValueExtractor<HcalMCParams> {
+	public:
+		typedef HcalMCParams Class;
+		typedef ExtractWhat<Class> What;
+		static What what() { return What();}
+
+		ValueExtractor(){}
+
+		ValueExtractor(What const & what)
+		{
+			// here one can make stuff really complicated...
+		}
+
+		void compute(Class const & it){
+			std::vector<float> res;
+			genericExtract(it, res);
+			swap(res);
+		}
+	private:
+
+	};
+
+	template<>
+	std::string PayLoadInspector<HcalMCParams>::summary() const {
+		return genericSummary(object());
+	}
+
+	template<>
+	std::string PayLoadInspector<HcalMCParams>::plot(std::string const & filename,
+		std::string const &,
+		std::vector<int> const&,
+		std::vector<float> const& ) const 
+	{
+		return genericPlot(object(), filename);
+	}
+}
+HCAL_PYTHON_WRAPPER(HcalMCParams,HcalMCParams);
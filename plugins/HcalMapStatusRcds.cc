@@ -0,0 +1,17 @@
+//registration of HCAL maps and channel status records, one plugin library per family of records;
+//IOVs with the same payload token share one object through PayloadCache
+
+#include "CondCore/HcalPlugins/interface/HcalCachedDataProxy.h"
+#include "CondFormats/HcalObjects/interface/HcalElectronicsMap.h"
+#include "CondFormats/HcalObjects/interface/HcalChannelQuality.h"
+#include "CondFormats/HcalObjects/interface/HcalDcsValues.h"
+#include "CondFormats/HcalObjects/interface/HcalDcsMap.h"
+#include "CondFormats/DataRecord/interface/HcalElectronicsMapRcd.h"
+#include "CondFormats/DataRecord/interface/HcalChannelQualityRcd.h"
+#include "CondFormats/DataRecord/interface/HcalDcsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalDcsMapRcd.h"
+
+REGISTER_CACHED_PLUGIN(HcalElectronicsMapRcd,HcalElectronicsMap);
+REGISTER_CACHED_PLUGIN(HcalChannelQualityRcd,HcalChannelQuality);
+REGISTER_CACHED_PLUGIN(HcalDcsRcd,HcalDcsValues);
+REGISTER_CACHED_PLUGIN(HcalDcsMapRcd,HcalDcsMap);
@@ -0,0 +1,17 @@
+//registration of HCAL pedestals and noise matrices records, one plugin library per family of records;
+//IOVs with the same payload token share one object through PayloadCache
+
+#include "CondCore/HcalPlugins/interface/HcalCachedDataProxy.h"
+#include "CondFormats/HcalObjects/interface/HcalPedestals.h"
+#include "CondFormats/HcalObjects/interface/HcalPedestalWidths.h"
+#include "CondFormats/HcalObjects/interface/HcalCholeskyMatrices.h"
+#include "CondFormats/HcalObjects/interface/HcalCovarianceMatrices.h"
+#include "CondFormats/DataRecord/interface/HcalPedestalsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalPedestalWidthsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalCholeskyMatricesRcd.h"
+#include "CondFormats/DataRecord/interface/HcalCovarianceMatricesRcd.h"
+
+REGISTER_CACHED_PLUGIN(HcalPedestalsRcd,HcalPedestals);
+REGISTER_CACHED_PLUGIN(HcalPedestalWidthsRcd,HcalPedestalWidths);
+REGISTER_CACHED_PLUGIN(HcalCholeskyMatricesRcd,HcalCholeskyMatrices);
+REGISTER_CACHED_PLUGIN(HcalCovarianceMatricesRcd,HcalCovarianceMatrices);
@@ -0,0 +1,267 @@
+#include "CondFormats/HcalObjects/interface/HcalPedestalWidths.h"
+#include "CondFormats/HcalObjects/interface/HcalPedestalWidth.h"
+
+#include "CondCore/Utilities/interface/PayLoadInspector.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
+
+#include <string>
+#include <fstream>
+#include <sstream>
+
+#include "TH1F.h"
+#include "TH2F.h"
+#include "DataFormats/DetId/interface/DetId.h"
+#include "DataFormats/HcalDetId/interface/HcalDetId.h"
+
+#include "math.h"
+//functions for correct representation of data in summary and plot:
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
+using namespace HcalObjRepresent;
+
+namespace {
+	//number of independent elements of symmetric 4x4 cap-ID covariance matrix
+	const unsigned int nSigmas = 10;
+
+	//element k of the packed lower triangle is sigma(capId1[k], capId2[k]):
+	//(0,0) (1,0) (1,1) (2,0) (2,1) (2,2) (3,0) (3,1) (3,2) (3,3)
+	const unsigned int capId1[nSigmas] = {0, 1, 1, 2, 2, 2, 3, 3, 3, 3};
+	const unsigned int capId2[nSigmas] = {0, 0, 1, 0, 1, 2, 0, 1, 2, 3};
+
+	//position of diagonal elements sigma(i,i) in the packed lower triangle
+	const unsigned int diagonal[4] = {0, 2, 5, 9};
+
+	// Covariance matrices of all channels, copied once out of the payload into
+	// one contiguous array (nSigmas floats per channel), in container order.
+	struct CovarianceArrays
+	{
+		std::vector<uint32_t> rawIds;
+		std::vector<float> sigmas;
+		//container name and number of channels in it
+		std::vector<std::pair<std::string, unsigned int> > containers;
+
+		explicit CovarianceArrays(HcalPedestalWidths const & widths){
+			ContainerView<HcalPedestalWidths> allContainers(widths);
+			ContainerView<HcalPedestalWidths>::const_iterator iter;
+			ContainerView<HcalPedestalWidths>::Span::const_iterator contIter;
+
+			unsigned int total = 0;
+			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter)
+				total += (*iter).second.size();
+			rawIds.reserve(total);
+			sigmas.resize(total * nSigmas);
+
+			std::vector<float>::iterator out = sigmas.begin();
+			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
+				containers.push_back(std::make_pair((*iter).first, (unsigned int)(*iter).second.size()));
+				for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
+					rawIds.push_back((uint32_t)(*contIter).rawId());
+					for (unsigned int k = 0; k < nSigmas; ++k, ++out)
+						*out = (*contIter).getSigma(capId1[k], capId2[k]);
+				}
+			}
+		}
+
+		//width of capId (sqrt of the diagonal element) for channel ch
+		float width(unsigned int ch, unsigned int capId) const {
+			return sqrt(fabs(sigmas[ch * nSigmas + diagonal[capId]]));
+		}
+
+		//correlation coefficient of packed off-diagonal element k for channel ch
+		float correlation(unsigned int ch, unsigned int k) const {
+			const float * s = &sigmas[ch * nSigmas];
+			float norm = sqrt(fabs(s[diagonal[capId1[k]]] * s[diagonal[capId2[k]]]));
+			return (norm > 0) ? s[k] / norm : 0;
+		}
+	};
+
+	//off-diagonal elements in packed order, used for correlation plots
+	const unsigned int offDiagonal[6] = {1, 3, 4, 6, 7, 8};
+
+	//raw ids of all channels in container order, the order of CovarianceArrays and extracted rows
+	std::vector<int> channelIds(HcalPedestalWidths const & widths){
+		ContainerView<HcalPedestalWidths> allContainers(widths);
+		ContainerView<HcalPedestalWidths>::const_iterator iter;
+		ContainerView<HcalPedestalWidths>::Span::const_iterator contIter;
+
+		std::vector<int> rawIds;
+		for (iter = allContainers.begin(); iter != allContainers.end(); ++iter)
+			for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter)
+				rawIds.push_back((int)(*contIter).rawId());
+		return rawIds;
+	}
+}
+
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalPedestalWidth>{
+		static const unsigned int nValues = nSigmas;
+		//packed lower triangle of covariance matrix
+		static float value(HcalPedestalWidth const & item, unsigned int i){
+			return item.getSigma(capId1[i], capId2[i]);
+		}
+		static std::string name(unsigned int i){
+			return indexedName(indexedName("Sigma", capId1[i]), capId2[i]);
+		}
+	};
+}
+
+namespace cond {
+	template<>
+	class ValueExtractor<HcalPedestalWidths>: public  BaseValueExtractor<HcalPedestalWidths> {
+	public:
+		typedef HcalPedestalWidths Class;
+		typedef ExtractWhat<Class> What;
+		static What what() { return What();}
+
+		ValueExtractor(){}
+
+		ValueExtractor(What const & what)
+		{
+			// here one can make stuff really complicated...
+		}
+
+		//all ten covariance elements of every channel, packed lower triangle: one row per channel,
+		//rows in container order, row i belongs to rawIds(object)[i]
+		void compute(Class const & it){
+			CovarianceArrays cov(it);
+			swap(cov.sigmas);
+		}
+	private:
+
+	};
+
+	class HcalPedestalWidthsDataRepr: public ADataRepr
+	{
+	public:
+		//value 0-3: width of capId, value 4-9: correlation of offDiagonal[value-4]
+		HcalPedestalWidthsDataRepr(unsigned int total, CovarianceArrays const & cov)
+			:ADataRepr(total), covariance(cov){}
+
+	protected:
+		CovarianceArrays const & covariance;
+
+		void doFillIn(std::vector<EtaPhiGrid> &grids){
+			float value = 0.0;
+
+			for (unsigned int ch = 0; ch < covariance.rawIds.size(); ++ch){
+				if (!setCell(covariance.rawIds[ch]))
+					continue;
+
+				//GET VALUES:
+				for (unsigned int i = 0; i < grids.size(); ++i){
+					if (i < 4)
+						value = covariance.width(ch, i);
+					else
+						value = covariance.correlation(ch, offDiagonal[i - 4]);
+					grids[i].fill(depth, ieta, iphi, value);
+				}
+			}
+		}
+	};
+
+	template<>
+	std::string PayLoadInspector<HcalPedestalWidths>::summary() const {
+		std::stringstream ss;
+		CovarianceArrays cov(object());
+
+		ss << "Total HCAL containers: " << cov.containers.size() << std::endl;
+
+		//one pass over contiguous covariance array of each container:
+		std::vector<double> sum(nSigmas), sqr_sum(nSigmas);
+		std::vector<float>::const_iterator s = cov.sigmas.begin();
+		float average = 0.0, std_dev = 0.0;
+
+		for (unsigned int c = 0; c < cov.containers.size(); ++c){
+			unsigned int size = cov.containers[c].second;
+			ss << "---------------------------------------------" << std::endl;
+			ss << "Detector: " << cov.containers[c].first << ";    Total values: "<< size << std::endl;
+
+			sum.assign(nSigmas, 0.0);
+			sqr_sum.assign(nSigmas, 0.0);
+			for (unsigned int ch = 0; ch < size; ++ch){
+				for (unsigned int k = 0; k < nSigmas; ++k, ++s){
+					sum[k] += *s;
+					sqr_sum[k] += (*s) * (*s);
+				}
+			}
+			if (size == 0)
+				continue;
+
+			for (unsigned int k = 0; k < nSigmas; ++k){
+				average = sum[k]/size;
+				//here needs to take absolute value for sqrt:
+				std_dev = sqrt( fabs((sqr_sum[k] / size) - (average * average)) );
+				if (capId1[k] == capId2[k])
+					ss  << "    Sigma (diagonal) " << capId1[k] << capId2[k] << " :"<< std::endl;
+				else
+					ss  << "    Sigma (off-diagonal) " << capId1[k] << capId2[k] << " :"<< std::endl;
+				ss	<< "          Average: " << average << "; "<< std::endl;
+				ss	<< "          Standart deviation: " << std_dev << "; " << std::endl;
+			}
+		}
+		return ss.str();
+	}
+
+	template<>
+	std::string PayLoadInspector<HcalPedestalWidths>::plot(std::string const & filename,
+		std::string const &,
+		std::vector<int> const&,
+		std::vector<float> const& ) const
+	{
+		//4 widths and 6 correlation coefficients
+		unsigned int numOfValues = 10;
+
+		CovarianceArrays cov(object());
+
+		//create object helper for making plots;
+		HcalPedestalWidthsDataRepr datarepr(numOfValues, cov);
+
+		datarepr.nr = 0;
+		datarepr.id = 0;
+		datarepr.rootname.str("_PedestalWidthrootvalue_");
+		datarepr.plotname.str("PedestalWidth ");
+		datarepr.filename.str("");
+		datarepr.filename << filename << "_PedestalWidth_";
+
+		typedef std::vector<TH2F> graphData;
+		std::vector< graphData > graphDataVec(numOfValues);
+		std::vector< graphData >::iterator imageIter;
+
+		//create images:
+		for (imageIter = graphDataVec.begin(); imageIter != graphDataVec.end(); ++imageIter){
+			if (datarepr.id >= 4){
+				unsigned int k = offDiagonal[datarepr.id - 4];
+				datarepr.nr = capId1[k] * 10 + capId2[k];
+				datarepr.rootname.str("_PedestalCorrelationrootvalue_");
+				datarepr.plotname.str("PedestalCorrelation ");
+				datarepr.filename.str("");
+				datarepr.filename << filename << "_PedestalCorrelation_";
+			}
+			datarepr.addImage((*imageIter));
+
+			++(datarepr.nr);
+			++(datarepr.id);
+		}
+		//MAIN FUNCTION:
+		datarepr.fillImages(graphDataVec);
+		return filename;
+	}
+}
+namespace {
+	std::vector<int> inspectorRawIds(cond::PayLoadInspector<HcalPedestalWidths> const & self){
+		HcalObjRepresent::ReleaseGIL nogil;
+		return channelIds(self.object());
+	}
+}
+namespace HcalObjRepresent{
+	//rawIds(object): raw ids of the rows of Extractor values, in the same order
+	template<>
+	struct PythonExtras<HcalPedestalWidths>
+	{
+		static void define(){
+			boost::python::def("rawIds", &inspectorRawIds);
+		}
+	};
+}
+HCAL_PYTHON_WRAPPER(HcalPedestalWidths,HcalPedestalWidths);
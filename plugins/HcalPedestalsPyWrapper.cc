@@ -2,7 +2,7 @@
 #include "CondFormats/HcalObjects/interface/HcalPedestal.h"
 
 #include "CondCore/Utilities/interface/PayLoadInspector.h"
-#include "CondCore/Utilities/interface/InspectorPythonWrapper.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
 
 #include <string>
 #include <fstream>
@@ -14,16 +14,27 @@
 #include "DataFormats/HcalDetId/interface/HcalDetId.h"
 
 #include "TROOT.h"
-#include "TCanvas.h"
-#include "TStyle.h"
-#include "TColor.h"
-#include "TLine.h"
 
 #include "math.h"
 //functions for correct representation of data in summary and plot:
 #include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
 using namespace HcalObjRepresent;
 
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalPedestal>{
+		static const unsigned int nValues = 8;
+		//4 pedestals followed by 4 widths
+		static float value(HcalPedestal const & item, unsigned int i){
+			return i < 4 ? item.getValue(i) : item.getWidth(i - 4);
+		}
+		static std::string name(unsigned int i){
+			return i < 4 ? indexedName("Pedestal", i) : indexedName("PedestalWidth", i - 4);
+		}
+	};
+}
+
 namespace cond {
 	template<>
 	class ValueExtractor<HcalPedestals>: public  BaseValueExtractor<HcalPedestals> {
@@ -48,42 +59,32 @@ namespace cond {
 	class HcalPedestalsDataRepr: public ADataRepr
 	{
 	public:
-		HcalPedestalsDataRepr(unsigned int total, HcalPedestals::tAllContWithNames const & allCont)
+		HcalPedestalsDataRepr(unsigned int total, ContainerView<HcalPedestals> const & allCont)
 			:ADataRepr(total), allContainers(allCont){}
 
 
 
 	protected:
-		HcalPedestals::tAllContWithNames allContainers;
+		ContainerView<HcalPedestals> allContainers;
 
-		void doFillIn(std::vector<TH2F> &graphData){
+		void doFillIn(std::vector<EtaPhiGrid> &grids){
 			//ITERATORS AND VALUES:
-			HcalPedestals::tAllContWithNames::const_iterator iter;
-			std::vector<HcalPedestal>::const_iterator contIter;
+			ContainerView<HcalPedestals>::const_iterator iter;
+			ContainerView<HcalPedestals>::Span::const_iterator contIter;
 			float value = 0.0;
 
 			//run trough all pair containers
 			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
 				//Run trough all values:
 				for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
-					hcal_id = HcalDetId((uint32_t)(*contIter).rawId());
-
-					depth = hcal_id.depth();
-					if (depth<1 || depth>4) 
+					if (!setCell((uint32_t)(*contIter).rawId()))
 						continue;
 
-					ieta=hcal_id.ieta();
-					iphi=hcal_id.iphi();
-
-					if (hcal_id.subdet() == HcalForward)
-						ieta>0 ? ++ieta : --ieta;
-
-					//GET VALUE:
-					value = (*contIter).getValue(id);
-					//logstatus = log2(1.*channelBits)+1;
-
-					//FILLING GOES HERE:
-					graphData[depth-1].Fill(ieta,iphi, value);	
+					//GET VALUES (all values of channel are loaded once):
+					for (unsigned int i = 0; i < grids.size(); ++i){
+						value = (*contIter).getValue(i);
+						grids[i].fill(depth, ieta, iphi, value);
+					}
 				}
 			}
 		}
@@ -94,11 +95,11 @@ namespace cond {
 		std::stringstream ss;
 		unsigned int totalValues = 8;
 		// get all containers with names
-		HcalPedestals::tAllContWithNames allContainers = object().getAllContainers();
+		ContainerView<HcalPedestals> allContainers(object());
 
 		// initializing iterators
-		HcalPedestals::tAllContWithNames::const_iterator iter;
-		std::vector<HcalPedestal>::const_iterator contIter;
+		ContainerView<HcalPedestals>::const_iterator iter;
+		ContainerView<HcalPedestals>::Span::const_iterator contIter;
 
 		ss << "Total HCAL containers: " << allContainers.size() << std::endl;
 
@@ -167,7 +168,7 @@ namespace cond {
 		unsigned int numOfValues = 8;
 
 		//create object helper for making plots;
-		HcalPedestalsDataRepr datarepr(numOfValues, object().getAllContainers());
+		HcalPedestalsDataRepr datarepr(numOfValues, ContainerView<HcalPedestals>(object()));
 
 		datarepr.nr = 0;
 		datarepr.id = 0;
@@ -189,13 +190,14 @@ namespace cond {
 				datarepr.filename.str("");
 				datarepr.filename << filename << "_PedestalWidth_";					
 			}
-			//MAIN FUNCTION:
-			datarepr.fillOneGain((*imageIter));
+			datarepr.addImage((*imageIter));
 
 			++(datarepr.nr);
 			++(datarepr.id);
 		}
+		//MAIN FUNCTION:
+		datarepr.fillImages(graphDataVec);
 		return filename;
 	}
 }
-PYTHON_WRAPPER(HcalPedestals,HcalPedestals);
\ No newline at end of file
+HCAL_PYTHON_WRAPPER(HcalPedestals,HcalPedestals);
\ No newline at end of file
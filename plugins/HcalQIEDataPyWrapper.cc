@@ -2,7 +2,7 @@
 #include "CondFormats/HcalObjects/interface/HcalQIECoder.h"
 
 #include "CondCore/Utilities/interface/PayLoadInspector.h"
-#include "CondCore/Utilities/interface/InspectorPythonWrapper.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
 
 #include <string>
 #include <fstream>
@@ -14,16 +14,27 @@
 #include "DataFormats/HcalDetId/interface/HcalDetId.h"
 
 #include "TROOT.h"
-#include "TCanvas.h"
-#include "TStyle.h"
-#include "TColor.h"
-#include "TLine.h"
 
 #include "math.h"
 //functions for correct representation of data in summary and plot:
 #include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
 using namespace HcalObjRepresent;
 
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalQIECoder>{
+		static const unsigned int nValues = 32;
+		//16 offsets followed by 16 slopes, ordered by capId and range (as getQIEParameters)
+		static float value(HcalQIECoder const & item, unsigned int i){
+			return i < 16 ? item.offset(i / 4, i % 4) : item.slope((i - 16) / 4, (i - 16) % 4);
+		}
+		static std::string name(unsigned int i){
+			return indexedName(indexedName(i < 16 ? "Offset" : "Slope", (i % 16) / 4), i % 4);
+		}
+	};
+}
+
 namespace cond {
 	template<>
 	class ValueExtractor<HcalQIEData>: public  BaseValueExtractor<HcalQIEData> {
@@ -45,60 +56,50 @@ namespace cond {
 
 	};
 
+	//all 32 parameters of coder: 16 offsets followed by 16 slopes, ordered by capId and range
+	void getQIEParameters(HcalQIECoder const & coder, float * values){
+		for (unsigned int fCapId = 0; fCapId < 4; ++fCapId){
+			for (unsigned int fRange = 0; fRange < 4; ++fRange){
+				values[fCapId*4 + fRange] = coder.offset (fCapId, fRange);
+				values[16 + fCapId*4 + fRange] = coder.slope (fCapId, fRange);
+			}
+		}
+	}
+
 	class HcalQIEDataDataRepr: public ADataRepr
 	{
 	protected:
-		HcalQIEData::tAllContWithNames allContainers;
+		ContainerView<HcalQIEData> allContainers;
 	public:
-		unsigned int fCapId;
-		unsigned int fRange;
-		bool slopeOrOffset;
-
-		HcalQIEDataDataRepr(unsigned int total, HcalQIEData::tAllContWithNames const & allCont)
-			:ADataRepr(total), allContainers(allCont), fCapId(0), fRange(0), slopeOrOffset(false){}
-
-
-
+		HcalQIEDataDataRepr(unsigned int total, ContainerView<HcalQIEData> const & allCont)
+			:ADataRepr(total), allContainers(allCont){}
 
 	protected:
-		void doFillIn(std::vector<TH2F> &graphData){
+		void doFillIn(std::vector<EtaPhiGrid> &grids){
 			//ITERATORS AND VALUES:
-			HcalQIEData::tAllContWithNames::const_iterator iter;
-			std::vector<HcalQIECoder>::const_iterator contIter;
-			float value = 0.0;
+			ContainerView<HcalQIEData>::const_iterator iter;
+			ContainerView<HcalQIEData>::Span::const_iterator contIter;
+			//offsets and slopes, in the same order as images
+			float values[32];
 
 			//run trough all pair containers
 			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
 				//Run trough all values:
 				for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
-					hcal_id = HcalDetId((uint32_t)(*contIter).rawId());
-
-					depth = hcal_id.depth();
-					if (depth<1 || depth>4) 
+					if (!setCell((uint32_t)(*contIter).rawId()))
 						continue;
 
-					ieta=hcal_id.ieta();
-					iphi=hcal_id.iphi();
-
-					if (hcal_id.subdet() == HcalForward)
-						ieta>0 ? ++ieta : --ieta;
-
-					//GET VALUE:
-					//unsigned fCapId, unsigned fRange;
-					if (slopeOrOffset){
-						value = (*contIter).slope(fCapId, fRange);
-					} else {
-						value = (*contIter).offset(fCapId, fRange);
-					}
-					//logstatus = log2(1.*channelBits)+1;
+					//GET VALUES (all 32 parameters of channel are loaded once):
+					getQIEParameters(*contIter, values);
 
 					//FILLING GOES HERE:
-					graphData[depth-1].Fill(ieta,iphi, value);	
+					for (unsigned int i = 0; i < grids.size() && i < 32; ++i)
+						grids[i].fill(depth, ieta, iphi, values[i]);
 				}
 			}
 		}
-	};
-
+	};
+
 	std::string QIEDataCounter(const int nr, unsigned int &formated_nr, int base = 4){
 		int numer = nr;
 		int tens = 0, ones = 0;
@@ -117,100 +118,36 @@ namespace cond {
 	std::string PayLoadInspector<HcalQIEData>::summary() const {
 		std::stringstream ss;
 		// get all containers with names
-		HcalQIEData::tAllContWithNames allContainers = object().getAllContainers();
+		ContainerView<HcalQIEData> allContainers(object());
 
 		// initializing iterators
-		HcalQIEData::tAllContWithNames::const_iterator iter;
-		std::vector<HcalQIECoder>::const_iterator contIter;
+		ContainerView<HcalQIEData>::const_iterator iter;
+		ContainerView<HcalQIEData>::Span::const_iterator contIter;
 
 		ss << "Total HCAL containers: " << allContainers.size() << std::endl;
 
-		typedef std::pair<std::pair< float, float >, int> tPora;
-
-		//std::vector<tPora> vMaz(allContainers.size());
-		//std::vector<tPora>::iterator iMaz = vMaz.begin();
-
-		std::vector<tPora> vOffsets(allContainers.size());// for each container (total 8)
-		std::vector<tPora> vSlopes(allContainers.size());// for each container (total 8)
-
-		std::vector<tPora>::iterator iOffset = vOffsets.begin();
-		std::vector<tPora>::iterator iSlope = vSlopes.begin();
-
-		float offset = .0;
-		float slope = .0;
-
+		//offsets and slopes of all capIds and ranges, accumulated in one pass:
+		float parameters[32];
+		ParameterSums sums(32);
 
 		//Run trough all 8 detector containers:
-		for (iter = allContainers.begin(); iter != allContainers.end(); ++iter, ++iOffset, ++iSlope){
-			iOffset->second = (*iter).second.size();// total number of values in detector
-			iSlope->second = (*iter).second.size();// total number of values in detector
-
-			(iOffset->first).first = .0;
-			(iOffset->first).second = .0;
-			(iSlope->first).first = .0;
-			(iSlope->first).second = .0;
-
+		for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
+			sums.reset();
 			//Run trough all values in container
-			unsigned int i = 0;
 			for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
-
-				//Run trough all values in object:
-				for (unsigned int fCapId = 0; fCapId < 4; ++fCapId){
-					for (unsigned int fRange = 0; fRange < 4; ++fRange){
-						offset =  (*contIter).offset (fCapId, fRange);
-						(iOffset->first).first += offset;
-						(iOffset->first).second+= (offset * offset);
-
-						slope = (*contIter).slope (fCapId, fRange);
-						(iSlope->first).first += slope;
-						(iSlope->first).second+= (slope * slope);
-					}
-				}
-				++i;
-				//ss << "[" << i << "] " << capValue << ", " << (iMaz->first).first[i] << ", " << (iMaz->first).second[i] << "; ";
+				getQIEParameters(*contIter, parameters);
+				sums.add(parameters);
 			}
-		}
-		//ss << std::endl;
-
-		//got all the values, now do the work:
-		iOffset = vOffsets.begin();
-		iSlope = vSlopes.begin();
-		float sumOffset = 0.0, averageOffset = 0.0, std_devOffset = 0.0, sqr_sumOffset = 0.0;
-		int sizeOffset = 0;
-
-		float sumSlope = 0.0, averageSlope = 0.0, std_devSlope = 0.0, sqr_sumSlope = 0.0;
-		int sizeSlope = 0;
-
-		sizeOffset = (*iOffset).second;
-		sizeSlope = (*iSlope).second;
-
-
-		
-		unsigned int i = 0;
-		for (iter = allContainers.begin(); iter != allContainers.end(); ++iter, ++i, ++iSlope, ++iOffset){
 
 			ss << "---------------------------------------------" << std::endl;
 			ss << "Detector: " << (*iter).first << ";    Total values: "<< (*iter).second.size() << std::endl;
-			sumOffset = ((*iOffset).first).first;
-			sqr_sumOffset = ((*iOffset).first).second;
-			averageOffset = sumOffset/sizeOffset;
-			//here needs to take absolute value for sqrt:
-			std_devOffset = sqrt( fabs((sqr_sumOffset / sizeOffset) - (averageOffset * averageOffset)) );
-
-			sumSlope = ((*iSlope).first).first;
-			sqr_sumSlope = ((*iSlope).first).second;
-			averageSlope = sumSlope/sizeSlope;
-			//here needs to take absolute value for sqrt:
-			std_devSlope = sqrt( fabs((sqr_sumSlope / sizeSlope) - (averageSlope * averageSlope)) );
-
 			ss  << "    Offset: " << std::endl;
-			ss	<< "          Average: " << averageOffset << "; "<< std::endl;
-			ss	<< "          Standart deviation: " << std_devOffset << "; " << std::endl;					
+			ss	<< "          Average: " << sums.channelAverage(0, 16) << "; "<< std::endl;
+			ss	<< "          Standart deviation: " << sums.channelStd_dev(0, 16) << "; " << std::endl;
 			ss  << "    Slope: " << std::endl;
-			ss	<< "          Average: " << averageSlope << "; "<< std::endl;
-			ss	<< "          Standart deviation: " << std_devSlope << "; " << std::endl;
-		}		
-		//std::cout << ss.str();
+			ss	<< "          Average: " << sums.channelAverage(16, 32) << "; "<< std::endl;
+			ss	<< "          Standart deviation: " << sums.channelStd_dev(16, 32) << "; " << std::endl;
+		}
 		return ss.str();
 	}
 
@@ -225,7 +162,7 @@ namespace cond {
 		unsigned int numOfValues = 32;
 
 		//create object helper for making plots;
-		HcalQIEDataDataRepr datarepr(numOfValues, object().getAllContainers());
+		HcalQIEDataDataRepr datarepr(numOfValues, ContainerView<HcalQIEData>(object()));
 
 		typedef std::vector<TH2F> graphData;
 		std::vector< graphData > graphDataVec(numOfValues);
@@ -241,14 +178,9 @@ namespace cond {
 		datarepr.plotname.str("Offset ");
 		datarepr.filename.str("");
 		datarepr.filename << filename << name;
-		//Run trough all values in object:
-		datarepr.slopeOrOffset = false;
 
 		for (unsigned int fCapId = 0; fCapId < 4; ++fCapId){
 			for (unsigned int fRange = 0; fRange < 4; ++fRange){
-				datarepr.fCapId = fCapId;
-				datarepr.fRange = fRange;
-
 				QIEDataCounter(datarepr.id, datarepr.nr);
 
 				if (datarepr.nr == 0){
@@ -262,7 +194,7 @@ namespace cond {
 
 
 
-				datarepr.fillOneGain((*imageIter));
+				datarepr.addImage((*imageIter));
 
 
 				++(datarepr.id);
@@ -277,15 +209,11 @@ namespace cond {
 		datarepr.filename.str("");
 		datarepr.filename << filename << name;	
 
-		datarepr.slopeOrOffset = true;
 		datarepr.nr = 0;
 		datarepr.id = 0;
 
 		for (unsigned int fCapId = 0; fCapId < 4; ++fCapId){
 			for (unsigned int fRange = 0; fRange < 4; ++fRange){
-				datarepr.fCapId = fCapId;
-				datarepr.fRange = fRange;
-
 				QIEDataCounter(datarepr.id, datarepr.nr);
 
 				if (datarepr.nr == 0){
@@ -297,7 +225,7 @@ namespace cond {
 					datarepr.filename << filename << name;
 				}
 
-				datarepr.fillOneGain((*imageIter));
+				datarepr.addImage((*imageIter));
 
 				++(datarepr.id);
 				++(datarepr.nr);
@@ -306,8 +234,10 @@ namespace cond {
 		}
 
 
+		//MAIN FUNCTION:
+		datarepr.fillImages(graphDataVec);
 		return filename;
 	}
 }
 
-PYTHON_WRAPPER(HcalQIEData,HcalQIEData);
\ No newline at end of file
+HCAL_PYTHON_WRAPPER(HcalQIEData,HcalQIEData);
\ No newline at end of file
@@ -0,0 +1,11 @@
+//registration of HCAL QIE calibrations records, one plugin library per family of records;
+//IOVs with the same payload token share one object through PayloadCache
+
+#include "CondCore/HcalPlugins/interface/HcalCachedDataProxy.h"
+#include "CondFormats/HcalObjects/interface/HcalQIEData.h"
+#include "CondFormats/HcalObjects/interface/HcalCalibrationQIEData.h"
+#include "CondFormats/DataRecord/interface/HcalQIEDataRcd.h"
+#include "CondFormats/DataRecord/interface/HcalCalibrationQIEDataRcd.h"
+
+REGISTER_CACHED_PLUGIN(HcalQIEDataRcd,HcalQIEData);
+REGISTER_CACHED_PLUGIN(HcalCalibrationQIEDataRcd,HcalCalibrationQIEData);
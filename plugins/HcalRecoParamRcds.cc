@@ -0,0 +1,20 @@
+//registration of HCAL reconstruction and simulation parameters records, one plugin library per family of records;
+//IOVs with the same payload token share one object through PayloadCache
+
+#include "CondCore/HcalPlugins/interface/HcalCachedDataProxy.h"
+#include "CondFormats/HcalObjects/interface/HcalRecoParams.h"
+#include "CondFormats/HcalObjects/interface/HcalLongRecoParams.h"
+#include "CondFormats/HcalObjects/interface/HcalMCParams.h"
+#include "CondFormats/HcalObjects/interface/HcalFlagHFDigiTimeParams.h"
+#include "CondFormats/HcalObjects/interface/HcalTimingParams.h"
+#include "CondFormats/DataRecord/interface/HcalRecoParamsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalLongRecoParamsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalMCParamsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalFlagHFDigiTimeParamsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalTimingParamsRcd.h"
+
+REGISTER_CACHED_PLUGIN(HcalRecoParamsRcd,HcalRecoParams);
+REGISTER_CACHED_PLUGIN(HcalLongRecoParamsRcd,HcalLongRecoParams);
+REGISTER_CACHED_PLUGIN(HcalMCParamsRcd,HcalMCParams);
+REGISTER_CACHED_PLUGIN(HcalFlagHFDigiTimeParamsRcd,HcalFlagHFDigiTimeParams);
+REGISTER_CACHED_PLUGIN(HcalTimingParamsRcd,HcalTimingParams);
@@ -2,7 +2,7 @@
 #include "CondFormats/HcalObjects/interface/HcalRespCorr.h"
 
 #include "CondCore/Utilities/interface/PayLoadInspector.h"
-#include "CondCore/Utilities/interface/InspectorPythonWrapper.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
 
 #include <string>
 #include <fstream>
@@ -16,8 +16,22 @@
 #include "math.h"
 //functions for correct representation of data in summary and plot:
 #include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
 using namespace HcalObjRepresent;
 
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalRespCorr>{
+		static const unsigned int nValues = 1;
+		static float value(HcalRespCorr const & item, unsigned int){
+			return item.getValue();
+		}
+		static std::string name(unsigned int){
+			return "RespCorr";
+		}
+	};
+}
+
 namespace cond {
 	template<>
 	class ValueExtractor<HcalRespCorrs>: public  BaseValueExtractor<HcalRespCorrs> {
@@ -42,42 +56,32 @@ namespace cond {
 	class HcalRespCorrsDataRepr: public ADataRepr
 	{
 	public:
-		HcalRespCorrsDataRepr(unsigned int total, HcalRespCorrs::tAllContWithNames const & allCont)
+		HcalRespCorrsDataRepr(unsigned int total, ContainerView<HcalRespCorrs> const & allCont)
 			:ADataRepr(total), allContainers(allCont){}
 
 
 
 	protected:
-		HcalRespCorrs::tAllContWithNames allContainers;
+		ContainerView<HcalRespCorrs> allContainers;
 
-		void doFillIn(std::vector<TH2F> &graphData){
+		void doFillIn(std::vector<EtaPhiGrid> &grids){
 			//ITERATORS AND VALUES:
-			HcalRespCorrs::tAllContWithNames::const_iterator iter;
-			std::vector<HcalRespCorr>::const_iterator contIter;
+			ContainerView<HcalRespCorrs>::const_iterator iter;
+			ContainerView<HcalRespCorrs>::Span::const_iterator contIter;
 			float value = 0.0;
 
 			//run trough all pair containers
 			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
 				//Run trough all values:
 				for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
-					hcal_id = HcalDetId((uint32_t)(*contIter).rawId());
-
-					depth = hcal_id.depth();
-					if (depth<1 || depth>4) 
+					if (!setCell((uint32_t)(*contIter).rawId()))
 						continue;
 
-					ieta=hcal_id.ieta();
-					iphi=hcal_id.iphi();
-
-					if (hcal_id.subdet() == HcalForward)
-						ieta>0 ? ++ieta : --ieta;
-
 					//GET VALUE:
 					value = (*contIter).getValue();
-					//logstatus = log2(1.*channelBits)+1;
 
 					//FILLING GOES HERE:
-					graphData[depth-1].Fill(ieta,iphi, value);	
+					grids[0].fill(depth, ieta, iphi, value);	
 				}
 			}
 		}
@@ -88,11 +92,11 @@ namespace cond {
 		std::stringstream ss;
 		unsigned int totalValues = 1;
 		// get all containers with names
-		HcalRespCorrs::tAllContWithNames allContainers = object().getAllContainers();
+		ContainerView<HcalRespCorrs> allContainers(object());
 
 		// initializing iterators
-		HcalRespCorrs::tAllContWithNames::const_iterator iter;
-		std::vector<HcalRespCorr>::const_iterator contIter;
+		ContainerView<HcalRespCorrs>::const_iterator iter;
+		ContainerView<HcalRespCorrs>::Span::const_iterator contIter;
 
 		ss << "Total HCAL containers: " << allContainers.size() << std::endl;
 
@@ -156,7 +160,7 @@ namespace cond {
 		unsigned int numOfValues = 1;
 
 		//create object helper for making plots;
-		HcalRespCorrsDataRepr datarepr(numOfValues, object().getAllContainers());
+		HcalRespCorrsDataRepr datarepr(numOfValues, ContainerView<HcalRespCorrs>(object()));
 
 		datarepr.nr = 0;
 		datarepr.id = 0;
@@ -171,13 +175,14 @@ namespace cond {
 
 		//create images:
 		for (imageIter = graphDataVec.begin(); imageIter != graphDataVec.end(); ++imageIter){
-			//MAIN FUNCTION:
-			datarepr.fillOneGain((*imageIter));
+			datarepr.addImage((*imageIter));
 
 			++(datarepr.nr);
 			++(datarepr.id);
 		}
+		//MAIN FUNCTION:
+		datarepr.fillImages(graphDataVec);
 		return filename;
 	}
 }
-PYTHON_WRAPPER(HcalRespCorrs,HcalRespCorrs);
\ No newline at end of file
+HCAL_PYTHON_WRAPPER(HcalRespCorrs,HcalRespCorrs);
\ No newline at end of file
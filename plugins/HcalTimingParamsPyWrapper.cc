@@ -0,0 +1,75 @@
+#include "CondFormats/HcalObjects/interface/HcalTimingParams.h"
+#include "CondFormats/HcalObjects/interface/HcalTimingParam.h"
+
+#include "CondCore/Utilities/interface/PayLoadInspector.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
+
+#include <string>
+#include <vector>
+
+//summary, plot and value extraction are generated from the field descriptor:
+#include "CondCore/HcalPlugins/interface/HcalGenericRepresent.h"
+using namespace HcalObjRepresent;
+
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalTimingParam>{
+		static const unsigned int nValues = 3;
+		static float value(HcalTimingParam const & item, unsigned int i){
+			switch(i){
+				case 0: return item.nhits();
+				case 1: return item.phase();
+				case 2: return item.rms();
+				default: throw("Trying to access not existing value!");
+			}
+		}
+		static std::string name(unsigned int i){
+			switch(i){
+				case 0: return "NHits";
+				case 1: return "Phase";
+				case 2: return "RMS";
+				default: throw("Trying to access not existing value!");
+			}
+		}
+	};
+}
+
+namespace cond {
+	template<>
+	class ValueExtractor<HcalTimingParams>: public  BaseValueExtractor<HcalTimingParams> {
+	public:
+		typedef HcalTimingParams Class;
+		typedef ExtractWhat<Class> What;
+		static What what() { return What();}
+
+		ValueExtractor(){}
+
+		ValueExtractor(What const & what)
+		{
+			// here one can make stuff really complicated...
+		}
+
+		void compute(Class const & it){
+			std::vector<float> res;
+			genericExtract(it, res);
+			swap(res);
+		}
+	private:
+
+	};
+
+	template<>
+	std::string PayLoadInspector<HcalTimingParams>::summary() const {
+		return genericSummary(object());
+	}
+
+	template<>
+	std::string PayLoadInspector<HcalTimingParams>::plot(std::string const & filename,
+		std::string const &,
+		std::vector<int> const&,
+		std::vector<float> const& ) const 
+	{
+		return genericPlot(object(), filename);
+	}
+}
+HCAL_PYTHON_WRAPPER(HcalTimingParams,HcalTimingParams);
@@ -0,0 +1,14 @@
+//registration of HCAL trigger and zero suppression records, one plugin library per family of records;
+//IOVs with the same payload token share one object through PayloadCache
+
+#include "CondCore/HcalPlugins/interface/HcalCachedDataProxy.h"
+#include "CondFormats/HcalObjects/interface/HcalL1TriggerObjects.h"
+#include "CondFormats/HcalObjects/interface/HcalLutMetadata.h"
+#include "CondFormats/HcalObjects/interface/HcalZSThresholds.h"
+#include "CondFormats/DataRecord/interface/HcalL1TriggerObjectsRcd.h"
+#include "CondFormats/DataRecord/interface/HcalLutMetadataRcd.h"
+#include "CondFormats/DataRecord/interface/HcalZSThresholdsRcd.h"
+
+REGISTER_CACHED_PLUGIN(HcalL1TriggerObjectsRcd,HcalL1TriggerObjects);
+REGISTER_CACHED_PLUGIN(HcalLutMetadataRcd,HcalLutMetadata);
+REGISTER_CACHED_PLUGIN(HcalZSThresholdsRcd,HcalZSThresholds);
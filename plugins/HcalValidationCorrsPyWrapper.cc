@@ -2,7 +2,7 @@
 #include "CondFormats/HcalObjects/interface/HcalValidationCorr.h"
 
 #include "CondCore/Utilities/interface/PayLoadInspector.h"
-#include "CondCore/Utilities/interface/InspectorPythonWrapper.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
 
 #include <string>
 #include <fstream>
@@ -16,8 +16,22 @@
 #include "math.h"
 //functions for correct representation of data in summary and plot:
 #include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
 using namespace HcalObjRepresent;
 
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalValidationCorr>{
+		static const unsigned int nValues = 1;
+		static float value(HcalValidationCorr const & item, unsigned int){
+			return item.getValue();
+		}
+		static std::string name(unsigned int){
+			return "ValidationCorr";
+		}
+	};
+}
+
 namespace cond {
 	template<>
 	class ValueExtractor<HcalValidationCorrs>: public  BaseValueExtractor<HcalValidationCorrs> {
@@ -42,42 +56,32 @@ namespace cond {
 	class HcalValidationCorrsDataRepr: public ADataRepr
 	{
 	public:
-		HcalValidationCorrsDataRepr(unsigned int total, HcalValidationCorrs::tAllContWithNames const & allCont)
+		HcalValidationCorrsDataRepr(unsigned int total, ContainerView<HcalValidationCorrs> const & allCont)
 			:ADataRepr(total), allContainers(allCont){}
 
 
 
 	protected:
-		HcalValidationCorrs::tAllContWithNames allContainers;
+		ContainerView<HcalValidationCorrs> allContainers;
 
-		void doFillIn(std::vector<TH2F> &graphData){
+		void doFillIn(std::vector<EtaPhiGrid> &grids){
 			//ITERATORS AND VALUES:
-			HcalValidationCorrs::tAllContWithNames::const_iterator iter;
-			std::vector<HcalValidationCorr>::const_iterator contIter;
+			ContainerView<HcalValidationCorrs>::const_iterator iter;
+			ContainerView<HcalValidationCorrs>::Span::const_iterator contIter;
 			float value = 0.0;
 
 			//run trough all pair containers
 			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
 				//Run trough all values:
 				for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
-					hcal_id = HcalDetId((uint32_t)(*contIter).rawId());
-
-					depth = hcal_id.depth();
-					if (depth<1 || depth>4) 
+					if (!setCell((uint32_t)(*contIter).rawId()))
 						continue;
 
-					ieta=hcal_id.ieta();
-					iphi=hcal_id.iphi();
-
-					if (hcal_id.subdet() == HcalForward)
-						ieta>0 ? ++ieta : --ieta;
-
 					//GET VALUE:
 					value = (*contIter).getValue();
-					//logstatus = log2(1.*channelBits)+1;
 
 					//FILLING GOES HERE:
-					graphData[depth-1].Fill(ieta,iphi, value);	
+					grids[0].fill(depth, ieta, iphi, value);	
 				}
 			}
 		}
@@ -88,11 +92,11 @@ namespace cond {
 		std::stringstream ss;
 		unsigned int totalValues = 1;
 		// get all containers with names
-		HcalValidationCorrs::tAllContWithNames allContainers = object().getAllContainers();
+		ContainerView<HcalValidationCorrs> allContainers(object());
 
 		// initializing iterators
-		HcalValidationCorrs::tAllContWithNames::const_iterator iter;
-		std::vector<HcalValidationCorr>::const_iterator contIter;
+		ContainerView<HcalValidationCorrs>::const_iterator iter;
+		ContainerView<HcalValidationCorrs>::Span::const_iterator contIter;
 
 		ss << "Total HCAL containers: " << allContainers.size() << std::endl;
 
@@ -157,7 +161,7 @@ namespace cond {
 		unsigned int numOfValues = 1;
 
 		//create object helper for making plots;
-		HcalValidationCorrsDataRepr datarepr(numOfValues, object().getAllContainers());
+		HcalValidationCorrsDataRepr datarepr(numOfValues, ContainerView<HcalValidationCorrs>(object()));
 
 		datarepr.nr = 0;
 		datarepr.id = 0;
@@ -172,13 +176,14 @@ namespace cond {
 
 		/*create images:*/
 		for (imageIter = graphDataVec.begin(); imageIter != graphDataVec.end(); ++imageIter){
-			//MAIN FUNCTION:
-			datarepr.fillOneGain((*imageIter));
+			datarepr.addImage((*imageIter));
 
 			++(datarepr.nr);
 			++(datarepr.id);
 		}
+		//MAIN FUNCTION:
+		datarepr.fillImages(graphDataVec);
 		return filename;
 	}
 }
-PYTHON_WRAPPER(HcalValidationCorrs,HcalValidationCorrs);
\ No newline at end of file
+HCAL_PYTHON_WRAPPER(HcalValidationCorrs,HcalValidationCorrs);
\ No newline at end of file
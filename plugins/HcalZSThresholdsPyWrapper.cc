@@ -2,7 +2,7 @@
 #include "CondFormats/HcalObjects/interface/HcalZSThreshold.h"
 
 #include "CondCore/Utilities/interface/PayLoadInspector.h"
-#include "CondCore/Utilities/interface/InspectorPythonWrapper.h"
+#include "CondCore/HcalPlugins/interface/HcalPythonWrapper.h"
 
 #include <string>
 #include <fstream>
@@ -16,8 +16,22 @@
 #include "math.h"
 //functions for correct representation of data in summary and plot:
 #include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalContainerView.h"
 using namespace HcalObjRepresent;
 
+namespace HcalObjRepresent{
+	template<>
+	struct FieldDescriptor<HcalZSThreshold>{
+		static const unsigned int nValues = 1;
+		static float value(HcalZSThreshold const & item, unsigned int){
+			return item.getValue();
+		}
+		static std::string name(unsigned int){
+			return "ZSThreshold";
+		}
+	};
+}
+
 namespace cond {
 	template<>
 	class ValueExtractor<HcalZSThresholds>: public  BaseValueExtractor<HcalZSThresholds> {
@@ -42,42 +56,32 @@ namespace cond {
 	class HcalZSThresholdsDataRepr: public ADataRepr
 	{
 	public:
-		HcalZSThresholdsDataRepr(unsigned int total, HcalZSThresholds::tAllContWithNames const & allCont)
+		HcalZSThresholdsDataRepr(unsigned int total, ContainerView<HcalZSThresholds> const & allCont)
 			:ADataRepr(total), allContainers(allCont){}
 
 
 
 	protected:
-		HcalZSThresholds::tAllContWithNames allContainers;
+		ContainerView<HcalZSThresholds> allContainers;
 
-		void doFillIn(std::vector<TH2F> &graphData){
+		void doFillIn(std::vector<EtaPhiGrid> &grids){
 			//ITERATORS AND VALUES:
-			HcalZSThresholds::tAllContWithNames::const_iterator iter;
-			std::vector<HcalZSThreshold>::const_iterator contIter;
+			ContainerView<HcalZSThresholds>::const_iterator iter;
+			ContainerView<HcalZSThresholds>::Span::const_iterator contIter;
 			int value = 0;
 
 			//run trough all pair containers
 			for (iter = allContainers.begin(); iter != allContainers.end(); ++iter){
 				//Run trough all values:
 				for (contIter = (*iter).second.begin(); contIter != (*iter).second.end(); ++contIter){
-					hcal_id = HcalDetId((uint32_t)(*contIter).rawId());
-
-					depth = hcal_id.depth();
-					if (depth<1 || depth>4) 
+					if (!setCell((uint32_t)(*contIter).rawId()))
 						continue;
 
-					ieta=hcal_id.ieta();
-					iphi=hcal_id.iphi();
-
-					if (hcal_id.subdet() == HcalForward)
-						ieta>0 ? ++ieta : --ieta;
-
 					//GET VALUE:
 					value = (*contIter).getValue();
-					//logstatus = log2(1.*channelBits)+1;
 
 					//FILLING GOES HERE:
-					graphData[depth-1].Fill(ieta,iphi, value);	
+					grids[0].fill(depth, ieta, iphi, value);	
 				}
 			}
 		}
@@ -88,11 +92,11 @@ namespace cond {
 		std::stringstream ss;
 		unsigned int totalValues = 1;
 		// get all containers with names
-		HcalZSThresholds::tAllContWithNames allContainers = object().getAllContainers();
+		ContainerView<HcalZSThresholds> allContainers(object());
 
 		// initializing iterators
-		HcalZSThresholds::tAllContWithNames::const_iterator iter;
-		std::vector<HcalZSThreshold>::const_iterator contIter;
+		ContainerView<HcalZSThresholds>::const_iterator iter;
+		ContainerView<HcalZSThresholds>::Span::const_iterator contIter;
 
 		ss << "Total HCAL containers: " << allContainers.size() << std::endl;
 
@@ -157,7 +161,7 @@ namespace cond {
 		unsigned int numOfValues = 1;
 
 		//create object helper for making plots;
-		HcalZSThresholdsDataRepr datarepr(numOfValues, object().getAllContainers());
+		HcalZSThresholdsDataRepr datarepr(numOfValues, ContainerView<HcalZSThresholds>(object()));
 
 		datarepr.nr = 0;
 		datarepr.id = 0;
@@ -172,13 +176,14 @@ namespace cond {
 
 		/*create images:*/
 		for (imageIter = graphDataVec.begin(); imageIter != graphDataVec.end(); ++imageIter){
-			//MAIN FUNCTION:
-			datarepr.fillOneGain((*imageIter));
+			datarepr.addImage((*imageIter));
 
 			++(datarepr.nr);
 			++(datarepr.id);
 		}
+		//MAIN FUNCTION:
+		datarepr.fillImages(graphDataVec);
 		return filename;
 	}
 }
-PYTHON_WRAPPER(HcalZSThresholds,HcalZSThresholds);
\ No newline at end of file
+HCAL_PYTHON_WRAPPER(HcalZSThresholds,HcalZSThresholds);
\ No newline at end of file
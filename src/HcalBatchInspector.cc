@@ -0,0 +1,31 @@
+#include "CondCore/HcalPlugins/interface/HcalBatchInspector.h"
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+
+#include <exception>
+
+namespace HcalObjRepresent{
+	WorkStealingPool & inspectorPool(){
+		static WorkStealingPool pool(boost::thread::hardware_concurrency());
+		return pool;
+	}
+
+	void BatchInspector::execute(Job const & job, Result &result){
+		bool bounded = boundedMemoryMode();
+		try{
+			//plots release their ROOT objects in the worker that made them
+			BoundedMemoryScope memory(bounded);
+			result.output = job();
+		}
+		catch(std::exception const & e){
+			result.error = e.what();
+		}
+		catch(char const * e){
+			result.error = e;
+		}
+		catch(...){
+			result.error = "unknown exception";
+		}
+		if (bounded)
+			result.memory = BoundedMemoryScope::lastMemoryReport();
+	}
+}
@@ -0,0 +1,12 @@
+#include "CondCore/HcalPlugins/interface/HcalCellGeometry.h"
+
+namespace HcalObjRepresent{
+	const int binmapd2[57]={-42,-41,-40,-39,-38,-37,-36,-35,-34,-33,-32,-31,-30,
+		-29,-28,-27,-26,-25,-24,-23,-22,-21,-20,-19,-18,-17,
+		-16,-15,-9999, 15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,
+		30,31,32,33,34,35,36,37,38,39,40,41,42};
+
+	// This stores eta binning in depth 3 (where HE is only present at a few ieta values)
+
+	const int binmapd3[9]={-28,-27,-9999,-16,-9999,16,-9999,27,28};
+}
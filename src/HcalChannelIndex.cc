@@ -0,0 +1,76 @@
+#include "CondCore/HcalPlugins/interface/HcalChannelIndex.h"
+#include "CondCore/HcalPlugins/interface/HcalCellGeometry.h"
+
+namespace HcalObjRepresent{
+	namespace {
+		const int nSubdets = 4;
+		const int maxIeta = 41;
+		const int maxDepth = 4;
+		const HcalSubdetector subdets[nSubdets] = {HcalBarrel, HcalEndcap, HcalOuter, HcalForward};
+
+		inline int subdetIndex(HcalSubdetector sd){
+			switch(sd){
+				case HcalBarrel: return 0;
+				case HcalEndcap: return 1;
+				case HcalOuter: return 2;
+				case HcalForward: return 3;
+				default: return -1;
+			}
+		}
+
+		// Cells of one (subdetector, ieta, depth): iphi = first, first + step, ... up to 72.
+		struct Ring
+		{
+			Ring():offset(-1), first(1), step(1){}
+			int offset, first, step;
+		};
+
+		// All rings, and slot order, are derived once from validDetId.
+		struct Layout
+		{
+			Ring rings[nSubdets][2 * maxIeta + 1][maxDepth];
+			std::vector<HcalDetId> detIds;
+
+			Layout(){
+				detIds.reserve(ChannelIndex::nChannels);
+				for (int sd = 0; sd < nSubdets; ++sd)
+					for (int ieta = -maxIeta; ieta <= maxIeta; ++ieta)
+						for (int depth = 1; depth <= maxDepth; ++depth){
+							Ring &ring = rings[sd][ieta + maxIeta][depth - 1];
+							for (int iphi = 1; iphi <= 72; ++iphi){
+								if (!validDetId(subdets[sd], ieta, iphi, depth))
+									continue;
+								if (ring.offset < 0){
+									ring.offset = detIds.size();
+									ring.first = iphi;
+								}
+								else if (detIds.size() == (unsigned int)ring.offset + 1)
+									ring.step = iphi - ring.first;
+								detIds.push_back(HcalDetId(subdets[sd], ieta, iphi, depth));
+							}
+						}
+				if (detIds.size() != ChannelIndex::nChannels)
+					throw("HcalObjRepresent::ChannelIndex: unexpected number of HCAL cells");
+			}
+		};
+
+		Layout const & layout(){
+			static const Layout l;
+			return l;
+		}
+	}
+
+	int ChannelIndex::slot(HcalSubdetector sd, int ieta, int iphi, int depth){
+		int s = subdetIndex(sd);
+		if (s < 0 || ieta < -maxIeta || ieta > maxIeta || depth < 1 || depth > maxDepth || iphi < 1 || iphi > 72)
+			return -1;
+		Ring const & ring = layout().rings[s][ieta + maxIeta][depth - 1];
+		if (ring.offset < 0 || iphi < ring.first || (iphi - ring.first) % ring.step != 0)
+			return -1;
+		return ring.offset + (iphi - ring.first) / ring.step;
+	}
+
+	std::vector<HcalDetId> const & ChannelIndex::detIds(){
+		return layout().detIds;
+	}
+}
@@ -0,0 +1,229 @@
+#include "CondCore/HcalPlugins/interface/HcalCompositeCalibration.h"
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+
+#include <sstream>
+#include <limits>
+#include <math.h>
+
+namespace HcalObjRepresent{
+	namespace {
+		const float missing = std::numeric_limits<float>::quiet_NaN();
+
+		typedef std::vector<std::vector<float> > tColumns;
+
+		struct StoreGains
+		{
+			tColumns &columns;
+			std::vector<unsigned char> &found;
+			unsigned char bit;
+			void operator()(int slot, HcalGain const & gain){
+				float sum = 0.0;
+				for (unsigned int capId = 0; capId < 4; ++capId){
+					columns[CompositeCalibration::Composite0 + capId][slot] = gain.getValue(capId);
+					sum += gain.getValue(capId);
+				}
+				columns[CompositeCalibration::Gain][slot] = sum / 4;
+				found[slot] |= bit;
+			}
+		};
+
+		struct StoreQIE
+		{
+			tColumns &columns;
+			std::vector<unsigned char> &found;
+			unsigned char bit;
+			//composite columns hold gains at this point
+			void operator()(int slot, HcalQIECoder const & coder){
+				float sum = 0.0;
+				for (unsigned int capId = 0; capId < 4; ++capId){
+					columns[CompositeCalibration::Composite0 + capId][slot] *= coder.slope(capId, 0);
+					sum += coder.slope(capId, 0);
+				}
+				columns[CompositeCalibration::QIESlope][slot] = sum / 4;
+				found[slot] |= bit;
+			}
+		};
+
+		// items with one value (getValue())
+		struct StoreValue
+		{
+			std::vector<float> &column;
+			std::vector<unsigned char> &found;
+			unsigned char bit;
+			template<class Item>
+			void operator()(int slot, Item const & item){
+				column[slot] = item.getValue();
+				found[slot] |= bit;
+			}
+		};
+	}
+
+	CompositeCalibration::CompositeCalibration(HcalGains const & gains, HcalRespCorrs const & respCorrs,
+		HcalQIEData const & qie, HcalPFCorrs const * pfCorrs, HcalTimeCorrs const * timeCorrs)
+		:m_columns(nColumns, std::vector<float>(ChannelIndex::nChannels, missing)),
+		m_found(ChannelIndex::nChannels, 0){
+		StoreGains storeGains = {m_columns, m_found, FoundGains};
+		forEachCell(gains, storeGains);
+		StoreQIE storeQIE = {m_columns, m_found, FoundQIE};
+		forEachCell(qie, storeQIE);
+		StoreValue storeRespCorr = {m_columns[RespCorr], m_found, FoundRespCorrs};
+		forEachCell(respCorrs, storeRespCorr);
+
+		//side by side, do not take part in composite
+		std::vector<unsigned char> unused(ChannelIndex::nChannels, 0);
+		if (pfCorrs){
+			StoreValue storePFCorr = {m_columns[PFCorr], unused, 0};
+			forEachCell(*pfCorrs, storePFCorr);
+		}
+		if (timeCorrs){
+			StoreValue storeTimeCorr = {m_columns[TimeCorr], unused, 0};
+			forEachCell(*timeCorrs, storeTimeCorr);
+		}
+
+		for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot){
+			if (!complete(slot)){
+				for (unsigned int capId = 0; capId < 4; ++capId)
+					m_columns[Composite0 + capId][slot] = missing;
+				continue;
+			}
+			float sum = 0.0;
+			for (unsigned int capId = 0; capId < 4; ++capId){
+				m_columns[Composite0 + capId][slot] *= m_columns[RespCorr][slot];
+				sum += m_columns[Composite0 + capId][slot];
+			}
+			m_columns[Composite][slot] = sum / 4;
+		}
+	}
+
+	std::string CompositeCalibration::columnName(unsigned int column){
+		switch(column){
+			case Composite0: return "Composite0";
+			case Composite1: return "Composite1";
+			case Composite2: return "Composite2";
+			case Composite3: return "Composite3";
+			case Composite: return "Composite";
+			case Gain: return "Gain";
+			case RespCorr: return "RespCorr";
+			case QIESlope: return "QIESlope";
+			case PFCorr: return "PFCorr";
+			case TimeCorr: return "TimeCorr";
+			default: throw("Trying to access not existing value!");
+		}
+	}
+
+	unsigned int CompositeCalibration::nComplete() const {
+		unsigned int n = 0;
+		for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot)
+			if (complete(slot))
+				++n;
+		return n;
+	}
+
+	void CompositeCalibration::values(std::vector<int> const & rawIds, std::vector<float> &values) const {
+		values.assign(rawIds.size() * nColumns, missing);
+		for (unsigned int row = 0; row < rawIds.size(); ++row){
+			int slot = ChannelIndex::slot(DetId((uint32_t)rawIds[row]));
+			if (slot < 0)
+				continue;
+			for (unsigned int c = 0; c < nColumns; ++c)
+				values[row * nColumns + c] = m_columns[c][slot];
+		}
+	}
+
+	std::string CompositeCalibration::summary() const {
+		std::stringstream ss;
+		const unsigned int nSubdets = 4;
+		const HcalSubdetector subdets[nSubdets] = {HcalBarrel, HcalEndcap, HcalOuter, HcalForward};
+		const char * const names[nSubdets] = {"HB", "HE", "HO", "HF"};
+		std::vector<HcalDetId> const & detIds = ChannelIndex::detIds();
+
+		ss << "Cells with gain, response correction and QIE slope: " << nComplete()
+			<< " of " << ChannelIndex::nChannels << std::endl;
+
+		std::vector<double> sum(nColumns), sqr_sum(nColumns);
+		std::vector<unsigned int> size(nColumns);
+		for (unsigned int sd = 0; sd < nSubdets; ++sd){
+			unsigned int cells = 0, complete = 0, noGains = 0, noRespCorrs = 0, noQIE = 0;
+			sum.assign(nColumns, 0.0);
+			sqr_sum.assign(nColumns, 0.0);
+			size.assign(nColumns, 0);
+
+			for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot){
+				if (detIds[slot].subdet() != subdets[sd])
+					continue;
+				++cells;
+				if (m_found[slot] == foundAll)
+					++complete;
+				if (!(m_found[slot] & FoundGains))
+					++noGains;
+				if (!(m_found[slot] & FoundRespCorrs))
+					++noRespCorrs;
+				if (!(m_found[slot] & FoundQIE))
+					++noQIE;
+				for (unsigned int c = 0; c < nColumns; ++c){
+					float value = m_columns[c][slot];
+					if (value != value)
+						continue;
+					sum[c] += value;
+					sqr_sum[c] += value * value;
+					++size[c];
+				}
+			}
+
+			ss << "---------------------------------------------" << std::endl;
+			ss << "Detector: " << names[sd] << ";    Cells: " << cells << ";    Complete: " << complete << std::endl;
+			ss << "    Missing gains: " << noGains << "; response corrections: " << noRespCorrs
+				<< "; QIE data: " << noQIE << std::endl;
+			for (unsigned int c = 0; c < nColumns; ++c){
+				if (size[c] == 0)
+					continue;
+				double average = sum[c] / size[c];
+				//here needs to take absolute value for sqrt:
+				double std_dev = sqrt( fabs((sqr_sum[c] / size[c]) - (average * average)) );
+				ss  << "    " << columnName(c) << " :"<< std::endl;
+				ss	<< "          Average: " << average << "; "<< std::endl;
+				ss	<< "          Standart deviation: " << std_dev << "; " << std::endl;
+			}
+		}
+		return ss.str();
+	}
+
+	namespace {
+		class CompositeDataRepr: public ADataRepr
+		{
+		public:
+			CompositeDataRepr(std::vector<float> const & values):ADataRepr(1), m_values(values){}
+
+		protected:
+			std::vector<float> const & m_values;
+
+			void doFillIn(std::vector<EtaPhiGrid> &grids){
+				std::vector<HcalDetId> const & detIds = ChannelIndex::detIds();
+				for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot){
+					if (m_values[slot] != m_values[slot])
+						continue;
+					if (!setCell(detIds[slot].rawId()))
+						continue;
+					for (unsigned int i = 0; i < grids.size(); ++i)
+						grids[i].fill(depth, ieta, iphi, m_values[slot]);
+				}
+			}
+		};
+	}
+
+	std::string CompositeCalibration::plot(std::string const & filename) const {
+		CompositeDataRepr datarepr(m_columns[Composite]);
+
+		datarepr.nr = 0;
+		datarepr.id = 0;
+		datarepr.rootname.str("_Compositerootvalue_");
+		datarepr.plotname.str("Gain x RespCorr x QIE slope ");
+		datarepr.filename.str("");
+		datarepr.filename << filename << "_Composite";
+
+		std::vector< std::vector<TH2F> > graphDataVec(1);
+		datarepr.addImage(graphDataVec[0]);
+		datarepr.fillImages(graphDataVec);
+		return filename;
+	}
+}
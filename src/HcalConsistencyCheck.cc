@@ -0,0 +1,245 @@
+#include "CondCore/HcalPlugins/interface/HcalConsistencyCheck.h"
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+
+#include <sstream>
+#include <limits>
+
+namespace HcalObjRepresent{
+	namespace {
+		//HcalChannelStatus::HcalCellDead
+		const unsigned int deadBit = 5;
+
+		// value of capId compared by the rules
+		inline float capValue(HcalGain const & item, unsigned int capId){return item.getValue(capId);}
+		inline float capValue(HcalGainWidth const & item, unsigned int capId){return item.getValue(capId);}
+		inline float capValue(HcalPedestal const & item, unsigned int capId){return item.getValue(capId);}
+		inline float capValue(HcalPedestalWidth const & item, unsigned int capId){return item.getWidth(capId);}
+		inline float capValue(HcalQIECoder const & item, unsigned int capId){return item.slope(capId, 0);}
+
+		struct StoreCapValues
+		{
+			std::vector<float> &values;
+			std::vector<unsigned char> &present;
+			unsigned char bit;
+			template<class Item>
+			void operator()(int slot, Item const & item){
+				for (unsigned int capId = 0; capId < 4; ++capId)
+					values[slot * 4 + capId] = capValue(item, capId);
+				present[slot] |= bit;
+			}
+		};
+
+		struct StoreStatus
+		{
+			std::vector<uint32_t> &status;
+			std::vector<unsigned char> &present;
+			unsigned char bit;
+			void operator()(int slot, HcalChannelStatus const & item){
+				status[slot] = item.getValue();
+				present[slot] |= bit;
+			}
+		};
+
+		const char * const subdetNames[ConsistencyCheck::nSubdets] = {"HB", "HE", "HO", "HF"};
+
+		unsigned int subdetOf(HcalDetId const & id){
+			switch(id.subdet()){
+				case HcalBarrel: return ConsistencyCheck::HB;
+				case HcalEndcap: return ConsistencyCheck::HE;
+				case HcalOuter: return ConsistencyCheck::HO;
+				default: return ConsistencyCheck::HF;
+			}
+		}
+	}
+
+	ConsistencyCheck::ConsistencyCheck()
+		:m_values(nInputs), m_status(ChannelIndex::nChannels, 0), m_added(0), m_present(ChannelIndex::nChannels, 0),
+		m_defaultGain(1.0), m_defaultSlope(std::numeric_limits<float>::quiet_NaN()),
+		m_flags(ChannelIndex::nChannels, 0), m_counts(nRules, std::vector<unsigned int>(nSubdets, 0)){}
+
+	namespace {
+		template<class Payload>
+		void addCapValues(Payload const & payload, std::vector<float> &values, std::vector<unsigned char> &present, unsigned char bit){
+			values.assign(ChannelIndex::nChannels * 4, 0.0);
+			StoreCapValues store = {values, present, bit};
+			forEachCell(payload, store);
+		}
+	}
+
+	void ConsistencyCheck::add(HcalGains const & gains){
+		addCapValues(gains, m_values[InGains], m_present, 1 << InGains);
+		m_added |= 1 << InGains;
+	}
+
+	void ConsistencyCheck::add(HcalGainWidths const & gainWidths){
+		addCapValues(gainWidths, m_values[InGainWidths], m_present, 1 << InGainWidths);
+		m_added |= 1 << InGainWidths;
+	}
+
+	void ConsistencyCheck::add(HcalPedestals const & pedestals){
+		addCapValues(pedestals, m_values[InPedestals], m_present, 1 << InPedestals);
+		m_added |= 1 << InPedestals;
+	}
+
+	void ConsistencyCheck::add(HcalPedestalWidths const & pedestalWidths){
+		addCapValues(pedestalWidths, m_values[InPedestalWidths], m_present, 1 << InPedestalWidths);
+		m_added |= 1 << InPedestalWidths;
+	}
+
+	void ConsistencyCheck::add(HcalQIEData const & qie){
+		addCapValues(qie, m_values[InQIE], m_present, 1 << InQIE);
+		m_added |= 1 << InQIE;
+	}
+
+	void ConsistencyCheck::add(HcalChannelQuality const & quality){
+		StoreStatus store = {m_status, m_present, 1 << InQuality};
+		forEachCell(quality, store);
+		m_added |= 1 << InQuality;
+	}
+
+	void ConsistencyCheck::run(){
+		std::vector<HcalDetId> const & detIds = ChannelIndex::detIds();
+		m_counts.assign(nRules, std::vector<unsigned int>(nSubdets, 0));
+
+		for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot){
+			unsigned int flags = 0;
+			bool gains = present(slot, InGains), qie = present(slot, InQIE);
+
+			//in some added payload, but not in all of them
+			if (m_present[slot] != 0 && m_present[slot] != m_added)
+				flags |= 1 << MissingChannel;
+
+			for (unsigned int capId = 0; capId < 4; ++capId){
+				if (gains && value(InGains, slot, capId) <= 0)
+					flags |= 1 << GainNotPositive;
+				if (gains && present(slot, InGainWidths) && value(InGainWidths, slot, capId) > value(InGains, slot, capId))
+					flags |= 1 << GainWidthAboveGain;
+				if (present(slot, InPedestals) && present(slot, InPedestalWidths)
+					&& value(InPedestalWidths, slot, capId) > value(InPedestals, slot, capId))
+					flags |= 1 << PedestalWidthAbovePedestal;
+			}
+
+			if (present(slot, InQuality) && isBitSet(deadBit, m_status[slot])){
+				for (unsigned int capId = 0; capId < 4; ++capId){
+					if (gains && value(InGains, slot, capId) != m_defaultGain)
+						flags |= 1 << DeadWithCalibration;
+					//NaN default: slopes are not compared
+					if (qie && m_defaultSlope == m_defaultSlope && value(InQIE, slot, capId) != m_defaultSlope)
+						flags |= 1 << DeadWithCalibration;
+				}
+			}
+
+			m_flags[slot] = flags;
+			for (unsigned int rule = 0; rule < nRules; ++rule)
+				if (flags & (1 << rule))
+					++m_counts[rule][subdetOf(detIds[slot])];
+		}
+	}
+
+	std::string ConsistencyCheck::ruleName(unsigned int rule){
+		switch(rule){
+			case GainNotPositive: return "GainNotPositive";
+			case GainWidthAboveGain: return "GainWidthAboveGain";
+			case PedestalWidthAbovePedestal: return "PedestalWidthAbovePedestal";
+			case MissingChannel: return "MissingChannel";
+			case DeadWithCalibration: return "DeadWithCalibration";
+			default: throw("Trying to access not existing value!");
+		}
+	}
+
+	std::string ConsistencyCheck::inputName(unsigned int input){
+		switch(input){
+			case InGains: return "HcalGains";
+			case InGainWidths: return "HcalGainWidths";
+			case InPedestals: return "HcalPedestals";
+			case InPedestalWidths: return "HcalPedestalWidths";
+			case InQIE: return "HcalQIEData";
+			case InQuality: return "HcalChannelQuality";
+			default: throw("Trying to access not existing value!");
+		}
+	}
+
+	std::vector<int> ConsistencyCheck::flagged(unsigned int rule) const {
+		std::vector<int> rawIds;
+		std::vector<HcalDetId> const & detIds = ChannelIndex::detIds();
+		for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot)
+			if (m_flags[slot] & (1 << rule))
+				rawIds.push_back((int)detIds[slot].rawId());
+		return rawIds;
+	}
+
+	std::string ConsistencyCheck::summary() const {
+		std::stringstream ss;
+		unsigned int flaggedCells = 0;
+		for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot)
+			if (m_flags[slot] != 0)
+				++flaggedCells;
+		ss << "Flagged cells: " << flaggedCells << " of " << ChannelIndex::nChannels << std::endl;
+
+		ss << "---------------------------------------------" << std::endl;
+		ss << "Rule";
+		for (unsigned int sd = 0; sd < nSubdets; ++sd)
+			ss << "; " << subdetNames[sd];
+		ss << std::endl;
+		for (unsigned int rule = 0; rule < nRules; ++rule){
+			ss << "    " << ruleName(rule);
+			for (unsigned int sd = 0; sd < nSubdets; ++sd)
+				ss << "; " << m_counts[rule][sd];
+			ss << std::endl;
+		}
+
+		//cells which are in some added payload, but not in this one
+		ss << "---------------------------------------------" << std::endl;
+		for (unsigned int input = 0; input < nInputs; ++input){
+			if (!added((Input)input))
+				continue;
+			unsigned int missing = 0;
+			for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot)
+				if (m_present[slot] != 0 && !present(slot, (Input)input))
+					++missing;
+			ss << "    Missing in " << inputName(input) << ": " << missing << std::endl;
+		}
+		return ss.str();
+	}
+
+	namespace {
+		class FlagDataRepr: public ADataRepr
+		{
+		public:
+			FlagDataRepr(std::vector<unsigned int> const & flags):ADataRepr(1), m_flags(flags){}
+
+		protected:
+			std::vector<unsigned int> const & m_flags;
+
+			void doFillIn(std::vector<EtaPhiGrid> &grids){
+				std::vector<HcalDetId> const & detIds = ChannelIndex::detIds();
+				for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot){
+					if (m_flags[slot] == 0 || !setCell(detIds[slot].rawId()))
+						continue;
+					float broken = 0;
+					for (unsigned int rule = 0; rule < ConsistencyCheck::nRules; ++rule)
+						if (m_flags[slot] & (1 << rule))
+							++broken;
+					for (unsigned int i = 0; i < grids.size(); ++i)
+						grids[i].fill(depth, ieta, iphi, broken);
+				}
+			}
+		};
+	}
+
+	std::string ConsistencyCheck::plot(std::string const & filename) const {
+		FlagDataRepr datarepr(m_flags);
+
+		datarepr.nr = 0;
+		datarepr.id = 0;
+		datarepr.rootname.str("_Flaggedrootvalue_");
+		datarepr.plotname.str("Broken consistency rules ");
+		datarepr.filename.str("");
+		datarepr.filename << filename << "_Flagged";
+
+		std::vector< std::vector<TH2F> > graphDataVec(1);
+		datarepr.addImage(graphDataVec[0]);
+		datarepr.fillImages(graphDataVec);
+		return filename;
+	}
+}
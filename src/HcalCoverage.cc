@@ -0,0 +1,152 @@
+#include "CondCore/HcalPlugins/interface/HcalCoverage.h"
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+
+#include <sstream>
+
+namespace HcalObjRepresent{
+	namespace {
+		CellBitmap makeAll(){
+			CellBitmap bitmap;
+			for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot)
+				bitmap.set(slot);
+			return bitmap;
+		}
+
+		bool isHcalCell(DetId id){
+			if (id.det() != DetId::Hcal)
+				return false;
+			switch(id.subdetId()){
+				case HcalBarrel:
+				case HcalEndcap:
+				case HcalOuter:
+				case HcalForward:
+					return true;
+				default:
+					return false;
+			}
+		}
+
+		const unsigned int nSubdets = 4;
+		const HcalSubdetector subdets[nSubdets] = {HcalBarrel, HcalEndcap, HcalOuter, HcalForward};
+		const char * const subdetNames[nSubdets] = {"HB", "HE", "HO", "HF"};
+	}
+
+	CellBitmap const & CellBitmap::all(){
+		static const CellBitmap bitmap = makeAll();
+		return bitmap;
+	}
+
+	unsigned int CellBitmap::count() const {
+		unsigned int n = 0;
+		for (unsigned int i = 0; i < nWords; ++i)
+			n += __builtin_popcountll(m_words[i]);
+		return n;
+	}
+
+	CellBitmap CellBitmap::minus(CellBitmap const & other) const {
+		CellBitmap result;
+		for (unsigned int i = 0; i < nWords; ++i)
+			result.m_words[i] = m_words[i] & ~other.m_words[i];
+		return result;
+	}
+
+	std::vector<int> CellBitmap::rawIds() const {
+		std::vector<int> ids;
+		std::vector<HcalDetId> const & detIds = ChannelIndex::detIds();
+		for (unsigned int i = 0; i < nWords; ++i){
+			//only words with set bits are looked at
+			for (uint64_t word = m_words[i]; word != 0; word &= word - 1)
+				ids.push_back((int)detIds[i * 64 + __builtin_ctzll(word)].rawId());
+		}
+		return ids;
+	}
+
+	void Coverage::add(DetId id){
+		if (!isHcalCell(id))
+			return;
+		++m_nChannels;
+		int slot = ChannelIndex::slot(id);
+		if (slot >= 0)
+			m_present.set(slot);
+		else
+			m_extra.push_back((int)id.rawId());
+	}
+
+	std::string Coverage::summary() const {
+		std::stringstream ss;
+		std::vector<HcalDetId> const & detIds = ChannelIndex::detIds();
+		CellBitmap missingCells = CellBitmap::all().minus(m_present);
+
+		ss << "HB/HE/HO/HF channels in payload: " << m_nChannels << ";    Valid cells covered: " << nCovered()
+			<< " of " << ChannelIndex::nChannels << std::endl;
+		ss << "Missing valid cells: " << missingCells.count() << ";    Extra invalid channels: " << m_extra.size() << std::endl;
+
+		for (unsigned int sd = 0; sd < nSubdets; ++sd){
+			unsigned int cells = 0, missing = 0, extra = 0;
+			for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot){
+				if (detIds[slot].subdet() != subdets[sd])
+					continue;
+				++cells;
+				if (missingCells.test(slot))
+					++missing;
+			}
+			for (unsigned int i = 0; i < m_extra.size(); ++i)
+				if (HcalDetId((uint32_t)m_extra[i]).subdet() == subdets[sd])
+					++extra;
+
+			ss << "---------------------------------------------" << std::endl;
+			ss << "Detector: " << subdetNames[sd] << ";    Valid cells: " << cells << ";    Missing: " << missing
+				<< ";    Extra: " << extra << std::endl;
+			for (unsigned int i = 0; i < m_extra.size(); ++i){
+				HcalDetId id((uint32_t)m_extra[i]);
+				if (id.subdet() == subdets[sd])
+					ss << "    Extra: " << id << std::endl;
+			}
+		}
+		return ss.str();
+	}
+
+	namespace {
+		class CoverageDataRepr: public ADataRepr
+		{
+		public:
+			//both images are named already, a total of 1 keeps nr out of the names
+			CoverageDataRepr(std::vector<int> const & missing, std::vector<int> const & extra)
+				:ADataRepr(1), m_missing(missing), m_extra(extra){}
+
+		protected:
+			std::vector<int> const & m_missing;
+			std::vector<int> const & m_extra;
+
+			void doFillIn(std::vector<EtaPhiGrid> &grids){
+				for (unsigned int i = 0; i < m_missing.size(); ++i)
+					if (setCell((uint32_t)m_missing[i]))
+						grids[0].fill(depth, ieta, iphi, 1);
+				for (unsigned int i = 0; i < m_extra.size() && grids.size() > 1; ++i)
+					if (setCell((uint32_t)m_extra[i]))
+						grids[1].fill(depth, ieta, iphi, 1);
+			}
+		};
+	}
+
+	std::string Coverage::plot(std::string const & filename) const {
+		std::vector<int> missingCells = missing();
+		CoverageDataRepr datarepr(missingCells, m_extra);
+
+		datarepr.id = 0;
+		std::vector< std::vector<TH2F> > graphDataVec(2);
+		const char * const names[2] = {"Missing", "Extra"};
+		for (unsigned int i = 0; i < graphDataVec.size(); ++i){
+			datarepr.nr = i;
+			datarepr.rootname.str("");
+			datarepr.rootname << "_" << names[i] << "rootvalue_";
+			datarepr.plotname.str("");
+			datarepr.plotname << names[i] << " cells ";
+			datarepr.filename.str("");
+			datarepr.filename << filename << "_" << names[i];
+			datarepr.addImage(graphDataVec[i]);
+		}
+		datarepr.fillImages(graphDataVec);
+		return filename;
+	}
+}
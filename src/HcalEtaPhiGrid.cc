@@ -0,0 +1,49 @@
+#include "CondCore/HcalPlugins/interface/HcalEtaPhiGrid.h"
+
+namespace HcalObjRepresent{
+	namespace {
+		std::vector<bool> makeMask(){
+			std::vector<bool> mask(EtaPhiGrid::nCells(), false);
+			const HcalSubdetector subdets[4] = {HcalBarrel, HcalEndcap, HcalOuter, HcalForward};
+			for (int sd = 0; sd < 4; ++sd)
+				for (int ieta = -41; ieta <= 41; ++ieta)
+					for (int depth = 1; depth <= EtaPhiGrid::nDepths; ++depth)
+						for (int iphi = 1; iphi <= EtaPhiGrid::nPhi; ++iphi){
+							if (!validDetId(subdets[sd], ieta, iphi, depth))
+								continue;
+							int eta = ieta;
+							if (subdets[sd] == HcalForward)
+								eta > 0 ? ++eta : --eta;
+							int i = EtaPhiGrid::index(depth, eta, iphi);
+							if (i >= 0)
+								mask[i] = true;
+						}
+			return mask;
+		}
+	}
+
+	std::string SubdetValues::name(unsigned int subdet){
+		switch(subdet){
+			case HB: return "HB";
+			case HE: return "HE";
+			case HO: return "HO";
+			case HF: return "HF";
+			default: throw("Trying to access not existing value!");
+		}
+	}
+
+	int SubdetValues::subdet(int depth, int etabin){
+		if (etabin < 0)
+			return -1;
+		if (isHB(etabin, depth)) return HB;
+		if (isHE(etabin, depth)) return HE;
+		if (isHO(etabin, depth)) return HO;
+		if (isHF(etabin, depth)) return HF;
+		return -1;
+	}
+
+	std::vector<bool> const & EtaPhiGrid::physicalCells(){
+		static const std::vector<bool> mask = makeMask();
+		return mask;
+	}
+}
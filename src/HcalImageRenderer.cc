@@ -0,0 +1,29 @@
+#include "CondCore/HcalPlugins/interface/HcalImageRenderer.h"
+
+#include <boost/thread/mutex.hpp>
+
+#include "FWCore/PluginManager/interface/PluginManager.h"
+#include "FWCore/PluginManager/interface/standard.h"
+
+EDM_REGISTER_PLUGINFACTORY(HcalObjRepresent::ImageRendererFactory, "HcalImageRendererFactory");
+
+namespace HcalObjRepresent{
+	namespace {
+		boost::mutex rendererMutex;
+		//kept until the end of the process, ROOT may be gone before static destructors run
+		ImageRenderer * renderer = 0;
+	}
+
+	ImageRenderer & imageRenderer(){
+		boost::mutex::scoped_lock lock(rendererMutex);
+		if (!renderer){
+			//python inspectors may run without a framework job which set up the plugin manager
+			if (!edmplugin::PluginManager::isAvailable())
+				edmplugin::PluginManager::configure(edmplugin::standard::config());
+			renderer = ImageRendererFactory::get()->create("HcalRootImageRenderer");
+			if (!renderer)
+				throw("HcalRootImageRenderer plugin not found");
+		}
+		return *renderer;
+	}
+}
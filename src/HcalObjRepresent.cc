@@ -0,0 +1,718 @@
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+#include "CondCore/HcalPlugins/interface/HcalImageRenderer.h"
+
+#include <fstream>
+#include <algorithm>
+#include <unistd.h>
+
+#include <boost/thread/tss.hpp>
+
+#include "TROOT.h"
+#include "TList.h"
+#include "TH1F.h"
+#include "TStyle.h"
+#include "TThread.h"
+#include "TVirtualMutex.h"
+
+namespace HcalObjRepresent{
+	const bool isBitSet(unsigned int bitnumber, unsigned int status)
+	{ 
+		unsigned int statadd = 0x1<<(bitnumber);
+		return (status&statadd)?(true):(false);
+	}
+
+
+	std::string getBitsSummary(uint32_t bits, std::string  statusBitArray[], short unsigned int bitMap[]  ){
+		std::stringstream ss;
+		for (unsigned int i = 0; i < 9; ++i){
+			if (isBitSet(bitMap[i], bits)){
+				ss << "[" <<bitMap[i]<< "]" << statusBitArray[bitMap[i]] << "; ";
+			}
+		}
+		ss << std::endl;
+		return ss.str();
+	}
+
+
+	//functions for making plot:
+	void setBinLabels(std::vector<TH2F> &depth)
+	{
+		// Set labels for all depth histograms
+		for (unsigned int i=0;i<depth.size();++i)
+		{
+			depth[i].SetXTitle("i#eta");
+			depth[i].SetYTitle("i#phi");
+		}
+
+		std::stringstream label;
+
+		// set label on every other bin
+		for (int i=-41;i<=-29;i=i+2)
+		{
+			label<<i;
+			depth[0].GetXaxis()->SetBinLabel(i+42,label.str().c_str());
+			depth[1].GetXaxis()->SetBinLabel(i+42,label.str().c_str());
+			label.str("");
+		}
+		depth[0].GetXaxis()->SetBinLabel(14,"-29HE");
+		depth[1].GetXaxis()->SetBinLabel(14,"-29HE");
+
+		// offset by one for HE
+		for (int i=-27;i<=27;i=i+2)
+		{
+			label<<i;
+			depth[0].GetXaxis()->SetBinLabel(i+43,label.str().c_str());
+			label.str("");
+		}
+		depth[0].GetXaxis()->SetBinLabel(72,"29HE");
+		for (int i=29;i<=41;i=i+2)
+		{
+			label<<i;
+			depth[0].GetXaxis()->SetBinLabel(i+44,label.str().c_str());
+			label.str("");
+		}
+		for (int i=16;i<=28;i=i+2)
+		{
+			label<<i-43;
+			depth[1].GetXaxis()->SetBinLabel(i,label.str().c_str());
+			label.str("");
+		}
+		depth[1].GetXaxis()->SetBinLabel(29,"NULL");
+		for (int i=15;i<=27;i=i+2)
+		{
+			label<<i;
+			depth[1].GetXaxis()->SetBinLabel(i+15,label.str().c_str());
+			label.str("");
+		}
+
+		depth[1].GetXaxis()->SetBinLabel(44,"29HE");
+		for (int i=29;i<=41;i=i+2)
+		{
+			label<<i;
+			depth[1].GetXaxis()->SetBinLabel(i+16,label.str().c_str());
+			label.str("");
+		}
+
+		// HE depth 3 labels;
+		depth[2].GetXaxis()->SetBinLabel(1,"-28");
+		depth[2].GetXaxis()->SetBinLabel(2,"-27");
+		depth[2].GetXaxis()->SetBinLabel(3,"Null");
+		depth[2].GetXaxis()->SetBinLabel(4,"-16");
+		depth[2].GetXaxis()->SetBinLabel(5,"Null");
+		depth[2].GetXaxis()->SetBinLabel(6,"16");
+		depth[2].GetXaxis()->SetBinLabel(7,"Null");
+		depth[2].GetXaxis()->SetBinLabel(8,"27");
+		depth[2].GetXaxis()->SetBinLabel(9,"28");
+	}
+
+
+	// Sets eta, phi labels for 'summary' eta-phi plots (identical to Depth 1 Eta-Phi labelling)
+
+	void SetEtaPhiLabels(TH2F &h)
+	{
+		std::stringstream label;
+		for (int i=-41;i<=-29;i=i+2)
+		{
+			label<<i;
+			h.GetXaxis()->SetBinLabel(i+42,label.str().c_str());
+			label.str("");
+		}
+		h.GetXaxis()->SetBinLabel(14,"-29HE");
+
+		// offset by one for HE
+		for (int i=-27;i<=27;i=i+2)
+		{
+			label<<i;
+			h.GetXaxis()->SetBinLabel(i+43,label.str().c_str());
+			label.str("");
+		}
+		h.GetXaxis()->SetBinLabel(72,"29HE");
+		for (int i=29;i<=41;i=i+2)
+		{
+			label<<i;
+			h.GetXaxis()->SetBinLabel(i+44,label.str().c_str());
+			label.str("");
+		}
+		return;
+	}
+
+
+	// Fill Unphysical bins in histograms
+	void FillUnphysicalHEHFBins(std::vector<TH2F> &hh)
+	{
+		int ieta=0;
+		int iphi=0;
+		// First 2 depths have 5-10-20 degree corrections
+		for (unsigned int d=0;d<3;++d)
+		{
+			//BUG CAN BE HERE:
+			//if (hh[d] != 0) continue;
+
+			for (int eta=0;eta<hh[d].GetNbinsX();++eta)
+			{
+				ieta=CalcIeta(eta,d+1);
+				if (ieta==-9999 || abs(ieta)<21) continue;
+				for (int phi=0;phi <hh[d].GetNbinsY();++phi)
+				{
+					iphi=phi+1;
+					if (iphi%2==1 && abs(ieta)<40 && iphi<73)
+					{
+						hh[d].SetBinContent(eta+1,iphi+1,hh[d].GetBinContent(eta+1,iphi));
+					}
+					// last two eta strips span 20 degrees in phi
+					// Fill the phi cell above iphi, and the 2 below it
+					else  if (abs(ieta)>39 && iphi%4==3 && iphi<73)
+					{
+						//ieta=40, iphi=3 covers iphi 3,4,5,6
+						hh[d].SetBinContent(eta+1,(iphi)%72+1, hh[d].GetBinContent(eta+1,iphi));
+						hh[d].SetBinContent(eta+1,(iphi+1)%72+1, hh[d].GetBinContent(eta+1,iphi));
+						hh[d].SetBinContent(eta+1,(iphi+2)%72+1, hh[d].GetBinContent(eta+1,iphi));
+					}
+				} // for (int phi...)
+			} // for (int eta...)
+		} // for (int d=0;...)
+		// no corrections needed for HO (depth 4)
+		return;
+	} // FillUnphysicalHEHFBins(MonitorElement* hh)
+
+
+	//Fill unphysical bins for single ME
+	void FillUnphysicalHEHFBins(TH2F &hh)
+	{
+		// Fills unphysical HE/HF bins for Summary Histogram
+		// Summary Histogram is binned with the same binning as the Depth 1 EtaPhiHists
+
+		//CAN BE BUG HERE:
+		//if (hh==0) return;
+
+		int ieta=0;
+		int iphi=0;
+		int etabins = hh.GetNbinsX();
+		int phibins = hh.GetNbinsY();
+		float binval=0;
+		for (int eta=0;eta<etabins;++eta) // loop over eta bins
+		{
+			ieta=CalcIeta(eta,1);
+			if (ieta==-9999 || abs(ieta)<21) continue;  // ignore etas that don't exist, or that have 5 degree phi binning
+
+			for (int phi=0;phi<phibins;++phi)
+			{
+				iphi=phi+1;
+				if (iphi%2==1 && abs(ieta)<40 && iphi<73) // 10 degree phi binning condition
+				{
+					binval=hh.GetBinContent(eta+1,iphi);
+					hh.SetBinContent(eta+1,iphi+1,binval);
+				} // if (iphi%2==1...) 
+				else if (abs(ieta)>39 && iphi%4==3 && iphi<73) // 20 degree phi binning condition
+				{
+					// Set last two eta strips where each cell spans 20 degrees in phi
+					// Set next phi cell above iphi, and 2 cells below the actual cell 
+					hh.SetBinContent(eta+1, (iphi)%72+1, hh.GetBinContent(eta+1,iphi));
+					hh.SetBinContent(eta+1, (iphi+1)%72+1, hh.GetBinContent(eta+1,iphi));
+					hh.SetBinContent(eta+1, (iphi+2)%72+1, hh.GetBinContent(eta+1,iphi));
+				} // else if (abs(ieta)>39 ...)
+			} // for (int phi=0;phi<72;++phi)
+
+		} // for (int eta=0; eta< (etaBins_-2);++eta)
+
+		return;
+	} // FillUnphysicalHEHFBins(std::vector<MonitorElement*> &hh)
+
+
+
+	RootLock::RootLock(){
+		if (!gGlobalMutex)
+			TThread::Initialize();
+		gGlobalMutex->Lock();
+		BoundedMemoryScope::locked();
+	}
+
+	RootLock::~RootLock(){
+		BoundedMemoryScope::unlocking();
+		gGlobalMutex->UnLock();
+	}
+
+	DetachedHistograms::DetachedHistograms():m_status(TH1::AddDirectoryStatus()){
+		TH1::AddDirectory(kFALSE);
+	}
+
+	DetachedHistograms::~DetachedHistograms(){
+		TH1::AddDirectory(m_status);
+	}
+
+	unsigned long residentMemory(){
+		std::ifstream statm("/proc/self/statm");
+		unsigned long size = 0, resident = 0;
+		statm >> size >> resident;
+		return resident * sysconf(_SC_PAGESIZE);
+	}
+
+	std::string MemoryReport::str() const {
+		std::stringstream ss;
+		ss << "RSS before: " << before / 1024 << " kB; peak: " << peak / 1024 << " kB; after: " << after / 1024
+			<< " kB; released ROOT objects: " << released;
+		return ss.str();
+	}
+
+	namespace {
+		bool boundedMemory = false;
+		bool profiles = false;
+		bool distributions = false;
+		unsigned int distributionBins = 100;
+		float distributionMin = 0, distributionMax = 0;
+
+		void noCleanup(BoundedMemoryScope *){}
+		//innermost scope of the thread
+		boost::thread_specific_ptr<BoundedMemoryScope> currentScope(&noCleanup);
+		boost::thread_specific_ptr<MemoryReport> lastReport;
+
+		struct NotIn
+		{
+			explicit NotIn(std::set<TObject*> const & objects):objects(objects){}
+			std::set<TObject*> const & objects;
+			bool operator()(TObject * obj) const {return !objects.count(obj);}
+		};
+	}
+
+	bool boundedMemoryMode(){
+		return boundedMemory;
+	}
+
+	void setBoundedMemory(bool on){
+		boundedMemory = on;
+	}
+
+	bool profilesMode(){
+		return profiles;
+	}
+
+	void setProfiles(bool on){
+		profiles = on;
+	}
+
+	bool distributionsMode(){
+		return distributions;
+	}
+
+	void setDistributions(bool on){
+		distributions = on;
+	}
+
+	void setDistributionBinning(unsigned int nBins, float min, float max){
+		if (nBins == 0)
+			throw("Number of bins must be positive");
+		distributionBins = nBins;
+		distributionMin = min;
+		distributionMax = max;
+	}
+
+	BoundedMemoryScope::BoundedMemoryScope(bool enabled):m_enabled(enabled), m_outer(0), m_lockDepth(0){
+		if (!m_enabled)
+			return;
+		m_report.before = m_report.peak = residentMemory();
+		m_outer = currentScope.get();
+		currentScope.reset(this);
+	}
+
+	BoundedMemoryScope::~BoundedMemoryScope(){
+		if (!m_enabled)
+			return;
+		currentScope.reset(m_outer);
+		{
+			RootLock lock;
+			//deleting one object may delete others, so each one is looked up again first
+			for (std::vector<TObject*>::const_iterator obj = m_created.begin(); obj != m_created.end(); ++obj){
+				if (!isRegistered(*obj))
+					continue;
+				delete *obj;
+				++m_report.released;
+			}
+		}
+		m_report.after = residentMemory();
+		checkpoint(m_report.after);
+		lastReport.reset(new MemoryReport(m_report));
+	}
+
+	void BoundedMemoryScope::checkpoint(unsigned long rss){
+		for (BoundedMemoryScope * scope = currentScope.get(); scope; scope = scope->m_outer)
+			if (rss > scope->m_report.peak)
+				scope->m_report.peak = rss;
+	}
+
+	std::string BoundedMemoryScope::lastMemoryReport(){
+		return lastReport.get() ? lastReport->str() : "";
+	}
+
+	void BoundedMemoryScope::locked(){
+		BoundedMemoryScope * scope = currentScope.get();
+		if (scope && scope->m_lockDepth++ == 0)
+			registered(scope->m_before);
+	}
+
+	// objects registered since the outermost lock, other than current gStyle, are made by this thread
+	void BoundedMemoryScope::unlocking(){
+		BoundedMemoryScope * scope = currentScope.get();
+		if (!scope || --scope->m_lockDepth != 0)
+			return;
+		std::set<TObject*> objects;
+		registered(objects);
+		//objects made before and deleted since are dropped, their address may be reused
+		std::vector<TObject*> &created = scope->m_created;
+		created.erase(std::remove_if(created.begin(), created.end(), NotIn(objects)), created.end());
+		for (std::set<TObject*>::const_iterator obj = objects.begin(); obj != objects.end(); ++obj)
+			if (!scope->m_before.count(*obj) && *obj != (TObject*)gStyle)
+				created.push_back(*obj);
+		scope->m_before.clear();
+	}
+
+	// must be called with RootLock held
+	bool BoundedMemoryScope::isRegistered(TObject * obj){
+		TSeqCollection const * lists[] = {gROOT->GetListOfCanvases(), gROOT->GetListOfStyles(),
+			gDirectory ? gDirectory->GetList() : 0};
+		for (unsigned int i = 0; i < sizeof(lists) / sizeof(lists[0]); ++i)
+			if (lists[i] && lists[i]->FindObject(obj))
+				return true;
+		return false;
+	}
+
+	void BoundedMemoryScope::insert(TSeqCollection const * list, std::set<TObject*> &objects){
+		if (!list)
+			return;
+		for (int i = 0; i < list->GetSize(); ++i)
+			objects.insert(list->At(i));
+	}
+
+	// must be called with RootLock held
+	void BoundedMemoryScope::registered(std::set<TObject*> &objects){
+		insert(gROOT->GetListOfCanvases(), objects);
+		insert(gROOT->GetListOfStyles(), objects);
+		if (gDirectory)
+			insert(gDirectory->GetList(), objects);
+		objects.erase((TObject*)0);
+	}
+
+	void drawDepths(std::vector<TH2F> &graphData, std::string const & filename) {
+		{
+			RootLock lock;
+			imageRenderer().drawDepths(graphData, filename);
+		}
+		BoundedMemoryScope::checkpoint();
+	}
+
+	void drawImage(TH2F &image, std::string const & filename, int width, int height) {
+		{
+			RootLock lock;
+			imageRenderer().drawImage(image, filename, width, height);
+		}
+		BoundedMemoryScope::checkpoint();
+	}
+
+	namespace {
+		// JSON array of the non empty rings or sectors of all depths
+		void writeMoments(std::ostream &out, EtaPhiProfiles const & profiles, bool rings){
+			bool first = true;
+			out << "[";
+			for (int d = 1; d <= EtaPhiProfiles::nDepths; ++d){
+				int n = rings ? EtaPhiProfiles::nRings : EtaPhiProfiles::nSectors;
+				for (int i = 0; i < n; ++i){
+					EtaPhiProfiles::Moments const & m = rings ? profiles.ring(d, i - 42) : profiles.sector(d, i + 1);
+					if (m.n == 0)
+						continue;
+					out << (first ? "" : ",") << std::endl << "  {\"depth\": " << d;
+					if (rings)
+						out << ", \"ieta\": " << EtaPhiProfiles::ieta(i - 42) << ", \"hf\": " << (abs(i - 42) > 29 ? "true" : "false");
+					else
+						out << ", \"iphi\": " << i + 1;
+					out << ", \"n\": " << m.n << ", \"mean\": " << m.mean() << ", \"rms\": " << m.rms() << "}";
+					first = false;
+				}
+			}
+			out << std::endl << " ]";
+		}
+	}
+
+	void saveProfiles(EtaPhiProfiles const & profiles, std::string const & name, std::string const & title, std::string const & file){
+		std::string base = file;
+		if (base.size() > 4 && base.compare(base.size() - 4, 4, ".png") == 0)
+			base.erase(base.size() - 4);
+
+		std::ofstream json((base + "_profiles.json").c_str());
+		json << "{\"image\": \"" << title << "\"," << std::endl << " \"rings\": ";
+		writeMoments(json, profiles, true);
+		json << "," << std::endl << " \"sectors\": ";
+		writeMoments(json, profiles, false);
+		json << std::endl << "}" << std::endl;
+
+		std::vector<TH1F> rings, sectors;
+		{
+			DetachedHistograms detached;
+			std::stringstream ss;
+			for (int d = 1; d <= EtaPhiProfiles::nDepths; ++d){
+				ss.str("");
+				ss << name << d << " rings";
+				rings.push_back(TH1F(ss.str().c_str(), "", EtaPhiProfiles::nRings, -42.5, 42.5));
+				ss.str("");
+				ss << title << d << " -- mean per ring";
+				rings.back().SetTitle(ss.str().c_str());
+				rings.back().SetXTitle("i#eta (HF shifted by one)");
+
+				ss.str("");
+				ss << name << d << " sectors";
+				sectors.push_back(TH1F(ss.str().c_str(), "", EtaPhiProfiles::nSectors, 0.5, 72.5));
+				ss.str("");
+				ss << title << d << " -- mean per sector";
+				sectors.back().SetTitle(ss.str().c_str());
+				sectors.back().SetXTitle("i#phi");
+
+				for (int eta = -42; eta <= 42; ++eta){
+					EtaPhiProfiles::Moments const & m = profiles.ring(d, eta);
+					if (m.n == 0)
+						continue;
+					rings.back().SetBinContent(eta + 43, m.mean());
+					rings.back().SetBinError(eta + 43, m.rms());
+				}
+				for (int iphi = 1; iphi <= EtaPhiProfiles::nSectors; ++iphi){
+					EtaPhiProfiles::Moments const & m = profiles.sector(d, iphi);
+					if (m.n == 0)
+						continue;
+					sectors.back().SetBinContent(iphi, m.mean());
+					sectors.back().SetBinError(iphi, m.rms());
+				}
+			}
+		}
+		{
+			RootLock lock;
+			imageRenderer().drawHistograms(rings, base + "_rings.png", "E");
+			imageRenderer().drawHistograms(sectors, base + "_sectors.png", "E");
+		}
+		BoundedMemoryScope::checkpoint();
+	}
+
+	void saveDistributions(SubdetValues const & values, std::string const & name, std::string const & title, std::string const & file){
+		std::string base = file;
+		if (base.size() > 4 && base.compare(base.size() - 4, 4, ".png") == 0)
+			base.erase(base.size() - 4);
+		//title of image without " for HCAL depth "
+		std::string what = title.substr(0, title.find(" for HCAL depth"));
+
+		std::vector<TH1F> histograms;
+		{
+			DetachedHistograms detached;
+			std::stringstream ss;
+			for (unsigned int sd = 0; sd < SubdetValues::nSubdets; ++sd){
+				std::vector<float> const & v = values.values(sd);
+				float min = distributionMin, max = distributionMax;
+				//automatic range: values of this subdetector, widened a bit so the largest one is not in overflow
+				if (min >= max){
+					min = max = 0;
+					if (!v.empty()){
+						min = *std::min_element(v.begin(), v.end());
+						max = *std::max_element(v.begin(), v.end());
+					}
+					float margin = (max > min) ? (max - min) * 0.01 : (fabs(max) > 0 ? fabs(max) * 0.01 : 1);
+					min -= margin;
+					max += margin;
+				}
+
+				ss.str("");
+				ss << name << " " << SubdetValues::name(sd) << " distribution";
+				histograms.push_back(TH1F(ss.str().c_str(), "", distributionBins, min, max));
+				ss.str("");
+				ss << what << " -- " << SubdetValues::name(sd) << " distribution";
+				histograms.back().SetTitle(ss.str().c_str());
+				for (std::vector<float>::const_iterator x = v.begin(); x != v.end(); ++x)
+					histograms.back().Fill(*x);
+			}
+		}
+		{
+			RootLock lock;
+			imageRenderer().drawHistograms(histograms, base + "_distributions.png", "HIST");
+		}
+		BoundedMemoryScope::checkpoint();
+	}
+
+	void Fill(HcalDetId& id, double val /*=1*/, std::vector<TH2F> &depth)
+	{ 
+		// If in HF, need to shift by 1 bin (-1 bin lower in -HF, +1 bin higher in +HF)
+		if (id.subdet()==HcalForward)
+			depth[id.depth()-1].Fill(id.ieta()<0 ? id.ieta()-1 : id.ieta()+1, id.iphi(), val);
+		else 
+			depth[id.depth()-1].Fill(id.ieta(),id.iphi(),val);
+	}
+
+	void Reset(std::vector<TH2F> &depth) 
+	{
+		for (unsigned int d=0;d<depth.size();d++)
+			//BUG CAN BE HERE:
+			//if(depth[d]) 
+			depth[d].Reset();
+	} // void Reset(void)
+
+	std::vector<TH2F> const & depthLayouts(){
+		static std::vector<TH2F> depth;
+		if (!depth.empty())
+			return depth;
+
+		// Push back depth plots
+		////////Create 4 plots:
+		//1. create first plot	
+		depth.push_back(TH2F("HB HE HF Depth 1", "Depth 1 -- HB HE HF",
+			85,-42.5,42.5,
+			72,0.5,72.5));
+
+		//2.1 prepare second plot	
+		float ybins[73];
+		for (int i=0;i<=72;i++) ybins[i]=(float)(i+0.5);
+		float xbinsd2[]={-42.5,-41.5,-40.5,-39.5,-38.5,-37.5,-36.5,-35.5,-34.5,-33.5,-32.5,-31.5,-30.5,-29.5,
+			-28.5,-27.5,-26.5,-25.5,-24.5,-23.5,-22.5,-21.5,-20.5,-19.5,-18.5,-17.5,-16.5,
+			-15.5,-14.5,
+			14.5, 15.5,
+			16.5,17.5,18.5,19.5,20.5,21.5,22.5,23.5,24.5,25.5,26.5,27.5,28.5,29.5,30.5,
+			31.5,32.5,33.5,34.5,35.5,36.5,37.5,38.5,39.5,40.5,41.5,42.5};
+
+		//2.2 create second plot	
+		depth.push_back(TH2F("HB HE HF Depth 2", "Depth 2 -- HB HE HF",
+			57, xbinsd2, 72, ybins));
+
+		//3.1 Set up variable-sized bins for HE depth 3 (MonitorElement also requires phi bins to be entered in array format)
+		float xbins[]={-28.5,-27.5,-26.5,-16.5,-15.5,
+			15.5,16.5,26.5,27.5,28.5};
+		//3.2
+		depth.push_back(TH2F("HE Depth 3", "Depth 3 -- HE",
+			// Use variable-sized eta bins 
+			9, xbins, 72, ybins));
+
+		//4.1 HO bins are fixed width, but cover a smaller eta range (-15 -> 15)
+		depth.push_back(TH2F("HO Depth 4", "Depth 4 -- HO",
+			31,-15.5,15.5,
+			72,0.5,72.5));
+
+		setBinLabels(depth); // set axis titles, special bins		
+		return depth;
+	}
+
+	void setup(std::vector<TH2F> &depth, std::string name, std::string units){
+		//histograms are kept out of gDirectory, so equal names in concurrent calls do not clash
+		DetachedHistograms detached;
+
+		std::string unittitle, unitname;
+		if (units.empty())
+		{
+			unitname = units;
+			unittitle = "No Units";
+		}
+		else
+		{
+			unitname = " " + units;
+			unittitle = units;
+		}
+
+		static const char * detectors[4] = {"HB HE HF", "HB HE HF", "HE", "HO"};
+		std::vector<TH2F> const & layouts = depthLayouts();
+		std::stringstream ss;
+		for (unsigned int d = 0; d < layouts.size(); ++d){
+			depth.push_back(layouts[d]);
+
+			ss.str("");
+			ss << detectors[d] << " Depth " << d+1 << " " << name << unitname;
+			depth.back().SetName(ss.str().c_str());
+			ss.str("");
+			ss << name << " Depth " << d+1 << " -- " << detectors[d] << " (" << unittitle << ")";
+			depth.back().SetTitle(ss.str().c_str());
+		}
+	}
+
+	void gridToDepths(EtaPhiGrid const & grid, std::vector<TH2F> &depth){
+		for (int d = 1; d <= EtaPhiGrid::nDepths && d <= (int)depth.size(); ++d){
+			for (int eta = 0; eta < EtaPhiGrid::nEta(d); ++eta)
+				for (int phi = 0; phi < EtaPhiGrid::nPhi; ++phi){
+					float value = grid.value(d, eta, phi);
+					if (value != 0)
+						depth[d-1].SetBinContent(eta+1, phi+1, value);
+				}
+			depth[d-1].SetEntries(grid.entries(d));
+		}
+	}
+
+	void ADataRepr::addImage(std::vector<TH2F> &, std::string units){
+		ImageSpec image;
+		std::stringstream ss("");
+
+		if (m_total == 1)
+			ss << rootname.str() << " for HCAL depth ";
+		else
+			ss << rootname.str() << nr << " for HCAL depth ";
+		image.name = ss.str();
+		image.units = units;
+
+		ss.str("");
+		if (m_total == 1)
+			ss << plotname.str() << " for HCAL depth ";
+		else
+			ss << plotname.str() << nr << " for HCAL depth ";
+		image.title = ss.str();
+
+		ss.str("");
+		if (m_total == 1)
+			ss << filename.str() << ".png";
+		else
+			ss << filename.str() << nr << ".png";
+		image.file = ss.str();
+
+		m_images.push_back(image);
+	}
+
+	void ADataRepr::fillImages(std::vector< std::vector<TH2F> > &images){
+		std::vector<EtaPhiGrid> grids(m_images.size());
+		if (profilesMode())
+			for (unsigned int i = 0; i < grids.size(); ++i)
+				grids[i].enableProfiles();
+		if (distributionsMode())
+			for (unsigned int i = 0; i < grids.size(); ++i)
+				grids[i].enableSubdetValues();
+		//overload this function:
+		doFillIn(grids);
+		BoundedMemoryScope::checkpoint();
+
+		for (unsigned int i = 0; i < images.size() && i < m_images.size(); ++i){
+			HcalObjRepresent::setup(images[i], m_images[i].name, m_images[i].units);
+
+			// Change the titles of each individual histogram
+			std::stringstream ss;
+			for (unsigned int d=0;d < images[i].size();++d){
+				ss.str("");
+				ss << m_images[i].title << d+1;
+				images[i][d].SetTitle(ss.str().c_str());
+			}
+
+			gridToDepths(grids[i], images[i]);
+			FillUnphysicalHEHFBins(images[i]);
+			draw(images[i], m_images[i].file);
+			std::vector<TH2F>().swap(images[i]);
+			if (grids[i].profiles().enabled())
+				saveProfiles(grids[i].profiles(), m_images[i].name, m_images[i].title, m_images[i].file);
+			if (grids[i].subdetValues().enabled())
+				saveDistributions(grids[i].subdetValues(), m_images[i].name, m_images[i].title, m_images[i].file);
+		}
+		m_images.clear();
+	}
+
+	bool ADataRepr::setCell(uint32_t rawId){
+		hcal_id = HcalDetId(rawId);
+
+		depth = hcal_id.depth();
+		if (depth<1 || depth>4) 
+			return false;
+
+		ieta=hcal_id.ieta();
+		iphi=hcal_id.iphi();
+
+		if (hcal_id.subdet() == HcalForward)
+			ieta>0 ? ++ieta : --ieta;
+		return true;
+	}
+
+	void ADataRepr::draw(std::vector<TH2F> &graphData, std::string filename) {
+		drawDepths(graphData, filename);
+	}
+}
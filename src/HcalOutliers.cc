@@ -0,0 +1,172 @@
+#include "CondCore/HcalPlugins/interface/HcalOutliers.h"
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+
+#include <sstream>
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <math.h>
+
+namespace HcalObjRepresent{
+	namespace {
+		const char * const subdetNames[Outliers::nSubdets] = {"HB", "HE", "HO", "HF"};
+
+		// subdetector of channel, -1 for channels of other detectors
+		int subdetOf(DetId id){
+			if (id.det() != DetId::Hcal)
+				return -1;
+			switch(id.subdetId()){
+				case HcalBarrel: return Outliers::HB;
+				case HcalEndcap: return Outliers::HE;
+				case HcalOuter: return Outliers::HO;
+				case HcalForward: return Outliers::HF;
+				default: return -1;
+			}
+		}
+
+		// median of buffer in linear time, buffer is reordered
+		float medianOf(std::vector<float> &buffer){
+			if (buffer.empty())
+				return std::numeric_limits<float>::quiet_NaN();
+			std::vector<float>::iterator middle = buffer.begin() + buffer.size() / 2;
+			std::nth_element(buffer.begin(), middle, buffer.end());
+			if (buffer.size() % 2 == 1)
+				return *middle;
+			//even size: lower middle is the largest value before middle
+			return (*middle + *std::max_element(buffer.begin(), middle)) / 2;
+		}
+
+		// normal standard deviation = 1.4826 * MAD
+		const float madScale = 1.4826;
+	}
+
+	Outliers::Outliers(std::vector<std::string> const & names, float threshold)
+		:m_names(names), m_threshold(threshold), m_rawIds(nSubdets), m_values(nSubdets),
+		m_median(nSubdets, std::vector<float>(names.size(), std::numeric_limits<float>::quiet_NaN())),
+		m_mad(m_median), m_counts(nSubdets, std::vector<unsigned int>(names.size(), 0)){}
+
+	void Outliers::add(DetId id, float const * values){
+		int sd = subdetOf(id);
+		if (sd < 0)
+			return;
+		m_rawIds[sd].push_back(id.rawId());
+		m_values[sd].insert(m_values[sd].end(), values, values + nValues());
+	}
+
+	void Outliers::run(){
+		unsigned int n = nValues();
+		m_entries.clear();
+		std::vector<float> scratch;
+
+		for (unsigned int sd = 0; sd < nSubdets; ++sd){
+			std::vector<float> const & values = m_values[sd];
+			unsigned int rows = m_rawIds[sd].size();
+			for (unsigned int i = 0; i < n; ++i){
+				//column of value i, NaN skipped
+				scratch.clear();
+				for (unsigned int row = 0; row < rows; ++row)
+					if (values[row * n + i] == values[row * n + i])
+						scratch.push_back(values[row * n + i]);
+				float median = medianOf(scratch);
+
+				//the same buffer again, for absolute deviations
+				for (unsigned int j = 0; j < scratch.size(); ++j)
+					scratch[j] = fabs(scratch[j] - median);
+				float mad = medianOf(scratch);
+
+				m_median[sd][i] = median;
+				m_mad[sd][i] = mad;
+				m_counts[sd][i] = 0;
+
+				//no scale to measure deviations in
+				if (!(mad > 0))
+					continue;
+
+				float limit = m_threshold * madScale * mad;
+				for (unsigned int row = 0; row < rows; ++row){
+					float x = values[row * n + i];
+					float deviation = fabs(x - median);
+					if (!(deviation > limit))
+						continue;
+					Entry entry = {m_rawIds[sd][row], i, x, deviation / (madScale * mad)};
+					m_entries.push_back(entry);
+					++m_counts[sd][i];
+				}
+			}
+		}
+	}
+
+	std::vector<int> Outliers::flagged() const {
+		std::set<uint32_t> unique;
+		for (std::vector<Entry>::const_iterator entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+			unique.insert(entry->rawId);
+		return std::vector<int>(unique.begin(), unique.end());
+	}
+
+	std::string Outliers::summary() const {
+		std::stringstream ss;
+		ss << "Outliers: |value - median| > " << m_threshold << " * 1.4826 * MAD;    Outlying values: " << m_entries.size()
+			<< ";    Channels: " << flagged().size() << std::endl;
+
+		for (unsigned int sd = 0; sd < nSubdets; ++sd){
+			ss << "---------------------------------------------" << std::endl;
+			ss << "Detector: " << subdetNames[sd] << ";    Total values: " << m_rawIds[sd].size() << std::endl;
+			if (m_rawIds[sd].empty())
+				continue;
+			for (unsigned int i = 0; i < nValues(); ++i){
+				ss  << "    " << m_names[i] << " :" << std::endl;
+				ss	<< "          Median: " << m_median[sd][i] << "; " << std::endl;
+				ss	<< "          MAD: " << m_mad[sd][i] << "; " << std::endl;
+				if (m_mad[sd][i] > 0)
+					ss	<< "          Outliers: " << m_counts[sd][i] << "; " << std::endl;
+				else
+					ss	<< "          Outliers: not tested, MAD is 0; " << std::endl;
+			}
+			//entries are grouped by subdetector and value
+			for (std::vector<Entry>::const_iterator entry = m_entries.begin(); entry != m_entries.end(); ++entry){
+				HcalDetId id(entry->rawId);
+				if (subdetOf(id) != (int)sd)
+					continue;
+				ss << "    Outlier: " << id << " " << m_names[entry->value] << " = " << entry->x
+					<< " (" << entry->deviation << " sigma)" << std::endl;
+			}
+		}
+		return ss.str();
+	}
+
+	namespace {
+		class OutlierDataRepr: public ADataRepr
+		{
+		public:
+			OutlierDataRepr(std::vector<Outliers::Entry> const & entries):ADataRepr(1), m_entries(entries){}
+
+		protected:
+			std::vector<Outliers::Entry> const & m_entries;
+
+			void doFillIn(std::vector<EtaPhiGrid> &grids){
+				for (std::vector<Outliers::Entry>::const_iterator entry = m_entries.begin(); entry != m_entries.end(); ++entry){
+					if (!setCell(entry->rawId))
+						continue;
+					for (unsigned int i = 0; i < grids.size(); ++i)
+						grids[i].fill(depth, ieta, iphi, 1);
+				}
+			}
+		};
+	}
+
+	std::string Outliers::plot(std::string const & filename) const {
+		OutlierDataRepr datarepr(m_entries);
+
+		datarepr.nr = 0;
+		datarepr.id = 0;
+		datarepr.rootname.str("_Outliersrootvalue_");
+		datarepr.plotname.str("Outlying values ");
+		datarepr.filename.str("");
+		datarepr.filename << filename << "_Outliers";
+
+		std::vector< std::vector<TH2F> > graphDataVec(1);
+		datarepr.addImage(graphDataVec[0]);
+		datarepr.fillImages(graphDataVec);
+		return filename;
+	}
+}
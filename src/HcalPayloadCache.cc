@@ -0,0 +1,58 @@
+#include "CondCore/HcalPlugins/interface/HcalPayloadCache.h"
+
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+namespace HcalObjRepresent{
+	namespace {
+		//HCAL_PAYLOAD_CACHE_SIZE sets the default, e.g. for cmsRun jobs
+		unsigned int initialCapacity(){
+			char const * env = std::getenv("HCAL_PAYLOAD_CACHE_SIZE");
+			return env ? std::strtoul(env, 0, 10) : 4;
+		}
+		unsigned int capacity = initialCapacity();
+
+		boost::mutex & registryMutex(){
+			static boost::mutex mutex;
+			return mutex;
+		}
+
+		std::vector<PayloadCacheBase *> & registry(){
+			static std::vector<PayloadCacheBase *> caches;
+			return caches;
+		}
+	}
+
+	void setPayloadCacheCapacity(unsigned int entries){
+		capacity = entries;
+	}
+
+	unsigned int payloadCacheCapacity(){
+		return capacity;
+	}
+
+	std::string payloadCacheReport(){
+		boost::mutex::scoped_lock lock(registryMutex());
+		std::stringstream ss;
+		std::vector<PayloadCacheBase *> const & caches = registry();
+		for (unsigned int i = 0; i < caches.size(); ++i){
+			PayloadCacheCounters counters = caches[i]->counters();
+			ss << caches[i]->name() << ": hits " << counters.hits << "; misses " << counters.misses
+				<< "; evictions " << counters.evictions << "; cached " << counters.entries << std::endl;
+		}
+		return ss.str();
+	}
+
+	PayloadCacheBase::PayloadCacheBase(std::string const & name):m_name(name){
+		boost::mutex::scoped_lock lock(registryMutex());
+		registry().push_back(this);
+	}
+
+	PayloadCacheBase::~PayloadCacheBase(){
+		boost::mutex::scoped_lock lock(registryMutex());
+		std::vector<PayloadCacheBase *> &caches = registry();
+		caches.erase(std::remove(caches.begin(), caches.end(), this), caches.end());
+	}
+}
@@ -0,0 +1,246 @@
+#include "CondCore/HcalPlugins/interface/HcalStability.h"
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <limits>
+#include <cstdlib>
+
+namespace HcalObjRepresent{
+	namespace {
+		const char fileTag[] = "HcalStabilityMap1";
+
+		const float nan = std::numeric_limits<float>::quiet_NaN();
+
+		// orders slots by RMS, largest first
+		struct ByRms
+		{
+			std::vector<float> const & rms;
+			bool operator()(unsigned int a, unsigned int b) const {return rms[a] > rms[b];}
+		};
+
+		template<class T>
+		void writeArray(std::ofstream &out, std::vector<T> const & v){
+			if (!v.empty())
+				out.write(reinterpret_cast<char const *>(&v[0]), v.size() * sizeof(T));
+		}
+
+		template<class T>
+		void readArray(std::ifstream &in, std::vector<T> &v){
+			if (!v.empty())
+				in.read(reinterpret_cast<char *>(&v[0]), v.size() * sizeof(T));
+		}
+	}
+
+	StabilityMap::StabilityMap(std::vector<std::string> const & names)
+		:m_names(names), m_nPayloads(0), m_counts(ChannelIndex::nChannels, 0),
+		m_mean(ChannelIndex::nChannels * names.size(), 0.0), m_m2(m_mean),
+		m_min(ChannelIndex::nChannels * names.size(), 0.0), m_max(m_min){}
+
+	void StabilityMap::add(unsigned int slot, float const * values){
+		unsigned int n = m_names.size();
+		uint32_t count = ++m_counts[slot];
+		for (unsigned int i = 0; i < n; ++i){
+			unsigned int k = slot * n + i;
+			double delta = values[i] - m_mean[k];
+			m_mean[k] += delta / count;
+			m_m2[k] += delta * (values[i] - m_mean[k]);
+			if (count == 1 || values[i] < m_min[k])
+				m_min[k] = values[i];
+			if (count == 1 || values[i] > m_max[k])
+				m_max[k] = values[i];
+		}
+	}
+
+	void StabilityMap::merge(StabilityMap const & other){
+		if (other.m_names != m_names)
+			throw("Stability maps of different values can not be merged");
+		unsigned int n = m_names.size();
+		for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot){
+			uint32_t a = m_counts[slot], b = other.m_counts[slot];
+			if (b == 0)
+				continue;
+			//pairwise update of mean and squared deviations (Chan et al.)
+			for (unsigned int i = 0; i < n; ++i){
+				unsigned int k = slot * n + i;
+				if (a == 0){
+					m_mean[k] = other.m_mean[k];
+					m_m2[k] = other.m_m2[k];
+					m_min[k] = other.m_min[k];
+					m_max[k] = other.m_max[k];
+					continue;
+				}
+				double delta = other.m_mean[k] - m_mean[k];
+				m_mean[k] += delta * b / (a + b);
+				m_m2[k] += other.m_m2[k] + delta * delta * a * b / (a + b);
+				m_min[k] = std::min(m_min[k], other.m_min[k]);
+				m_max[k] = std::max(m_max[k], other.m_max[k]);
+			}
+			m_counts[slot] = a + b;
+		}
+		m_nPayloads += other.m_nPayloads;
+	}
+
+	int StabilityMap::slotOf(int rawId, unsigned int value) const {
+		int slot = ChannelIndex::slot(DetId((uint32_t)rawId));
+		if (slot < 0 || value >= m_names.size() || m_counts[slot] == 0)
+			return -1;
+		return slot;
+	}
+
+	float StabilityMap::slotRms(unsigned int slot, unsigned int value) const {
+		return sqrt(m_m2[slot * m_names.size() + value] / m_counts[slot]);
+	}
+
+	unsigned int StabilityMap::count(int rawId) const {
+		int slot = ChannelIndex::slot(DetId((uint32_t)rawId));
+		return slot < 0 ? 0 : m_counts[slot];
+	}
+
+	float StabilityMap::mean(int rawId, unsigned int value) const {
+		int slot = slotOf(rawId, value);
+		return slot < 0 ? nan : m_mean[slot * m_names.size() + value];
+	}
+
+	float StabilityMap::rms(int rawId, unsigned int value) const {
+		int slot = slotOf(rawId, value);
+		return slot < 0 ? nan : slotRms(slot, value);
+	}
+
+	float StabilityMap::min(int rawId, unsigned int value) const {
+		int slot = slotOf(rawId, value);
+		return slot < 0 ? nan : m_min[slot * m_names.size() + value];
+	}
+
+	float StabilityMap::max(int rawId, unsigned int value) const {
+		int slot = slotOf(rawId, value);
+		return slot < 0 ? nan : m_max[slot * m_names.size() + value];
+	}
+
+	std::vector<int> StabilityMap::leastStable(unsigned int value, unsigned int n) const {
+		std::vector<int> rawIds;
+		if (value >= m_names.size())
+			return rawIds;
+
+		std::vector<float> rms(ChannelIndex::nChannels, 0);
+		std::vector<unsigned int> slots;
+		for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot){
+			if (m_counts[slot] == 0)
+				continue;
+			rms[slot] = slotRms(slot, value);
+			slots.push_back(slot);
+		}
+		n = std::min(n, (unsigned int)slots.size());
+		ByRms byRms = {rms};
+		std::partial_sort(slots.begin(), slots.begin() + n, slots.end(), byRms);
+
+		std::vector<HcalDetId> const & detIds = ChannelIndex::detIds();
+		for (unsigned int i = 0; i < n; ++i)
+			rawIds.push_back((int)detIds[slots[i]].rawId());
+		return rawIds;
+	}
+
+	std::string StabilityMap::summary(unsigned int n) const {
+		std::stringstream ss;
+		unsigned int channels = 0;
+		for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot)
+			if (m_counts[slot] != 0)
+				++channels;
+		ss << "Payloads: " << m_nPayloads << ";    Channels: " << channels << std::endl;
+
+		for (unsigned int i = 0; i < m_names.size(); ++i){
+			ss << "---------------------------------------------" << std::endl;
+			ss << "    " << m_names[i] << " least stable:" << std::endl;
+			std::vector<int> rawIds = leastStable(i, n);
+			for (std::vector<int>::const_iterator id = rawIds.begin(); id != rawIds.end(); ++id)
+				ss << "          " << HcalDetId((uint32_t)*id) << " RMS: " << rms(*id, i) << "; mean: " << mean(*id, i)
+					<< "; min: " << min(*id, i) << "; max: " << max(*id, i) << "; payloads: " << count(*id) << std::endl;
+		}
+		return ss.str();
+	}
+
+	namespace {
+		class StabilityDataRepr: public ADataRepr
+		{
+		public:
+			//images are named after their values, a total of 1 keeps nr out of the names
+			explicit StabilityDataRepr(StabilityMap const & map):ADataRepr(1), m_map(map){}
+
+		protected:
+			StabilityMap const & m_map;
+
+			void doFillIn(std::vector<EtaPhiGrid> &grids){
+				std::vector<HcalDetId> const & detIds = ChannelIndex::detIds();
+				for (unsigned int slot = 0; slot < ChannelIndex::nChannels; ++slot){
+					int rawId = (int)detIds[slot].rawId();
+					if (m_map.count(rawId) == 0 || !setCell(rawId))
+						continue;
+					for (unsigned int i = 0; i < grids.size(); ++i)
+						grids[i].fill(depth, ieta, iphi, m_map.rms(rawId, i));
+				}
+			}
+		};
+	}
+
+	std::string StabilityMap::plot(std::string const & filename) const {
+		unsigned int numOfValues = m_names.size();
+		StabilityDataRepr datarepr(*this);
+
+		datarepr.id = 0;
+		std::vector< std::vector<TH2F> > graphDataVec(numOfValues);
+		for (unsigned int i = 0; i < numOfValues; ++i){
+			datarepr.nr = i;
+			datarepr.rootname.str("");
+			datarepr.rootname << "_" << m_names[i] << "RMSrootvalue_";
+			datarepr.plotname.str("");
+			datarepr.plotname << m_names[i] << " RMS over " << m_nPayloads << " payloads ";
+			datarepr.filename.str("");
+			datarepr.filename << filename << "_" << m_names[i] << "_RMS";
+			datarepr.addImage(graphDataVec[i]);
+		}
+		datarepr.fillImages(graphDataVec);
+		return filename;
+	}
+
+	void StabilityMap::save(std::string const & filename) const {
+		std::ofstream out(filename.c_str(), std::ios::binary);
+		if (!out)
+			throw("Can not write stability map file");
+		//header lines: tag, number of names, one name per line, number of payloads
+		out << fileTag << std::endl << m_names.size() << std::endl;
+		for (unsigned int i = 0; i < m_names.size(); ++i)
+			out << m_names[i] << std::endl;
+		out << m_nPayloads << std::endl;
+		writeArray(out, m_counts);
+		writeArray(out, m_mean);
+		writeArray(out, m_m2);
+		writeArray(out, m_min);
+		writeArray(out, m_max);
+	}
+
+	StabilityMap StabilityMap::load(std::string const & filename){
+		std::ifstream in(filename.c_str(), std::ios::binary);
+		std::string tag, line;
+		std::getline(in, tag);
+		std::getline(in, line);
+		if (!in || tag != fileTag)
+			throw("Not a stability map file");
+		//names are whole lines, they may contain spaces
+		std::vector<std::string> names(strtoul(line.c_str(), 0, 10));
+		for (unsigned int i = 0; i < names.size(); ++i)
+			std::getline(in, names[i]);
+
+		StabilityMap map(names);
+		in >> map.m_nPayloads;
+		in.get();
+		readArray(in, map.m_counts);
+		readArray(in, map.m_mean);
+		readArray(in, map.m_m2);
+		readArray(in, map.m_min);
+		readArray(in, map.m_max);
+		if (!in)
+			throw("Stability map file is truncated");
+		return map;
+	}
+}
@@ -0,0 +1,182 @@
+#include "CondCore/HcalPlugins/interface/HcalTriggerTowers.h"
+#include "CondCore/HcalPlugins/interface/HcalObjRepresent.h"
+
+#include <sstream>
+#include <limits>
+
+namespace HcalObjRepresent{
+	namespace {
+		std::pair<int, int> cellTowers(HcalDetId const & id){
+			int aieta = id.ietaAbs(), iphi = id.iphi(), zside = id.zside();
+			switch(id.subdet()){
+				case HcalBarrel:
+				case HcalEndcap:{
+					int ieta = zside * (aieta > 28 ? 28 : aieta);
+					if (aieta >= 21)
+						return std::make_pair(TowerIndex::slot(ieta, iphi), TowerIndex::slot(ieta, iphi % 72 + 1));
+					return std::make_pair(TowerIndex::slot(ieta, iphi), -1);
+				}
+				case HcalForward:{
+					//one cell per HF position, depth 2 lies behind depth 1
+					if (id.depth() != 1)
+						return std::make_pair(-1, -1);
+					int ieta = aieta >= 38 ? 32 : 29 + (aieta - 29) / 3;
+					return std::make_pair(TowerIndex::slot(zside * ieta, ((iphi + 1) / 4 * 4 + 1) % 72), -1);
+				}
+				default:
+					return std::make_pair(-1, -1);
+			}
+		}
+
+		std::vector<std::pair<int, int> > makeTable(){
+			std::vector<HcalDetId> const & detIds = ChannelIndex::detIds();
+			std::vector<std::pair<int, int> > table(detIds.size());
+			for (unsigned int slot = 0; slot < detIds.size(); ++slot)
+				table[slot] = cellTowers(detIds[slot]);
+			return table;
+		}
+	}
+
+	std::vector<std::pair<int, int> > const & TowerIndex::table(){
+		static const std::vector<std::pair<int, int> > towers = makeTable();
+		return towers;
+	}
+
+	TriggerTowers::TriggerTowers(std::vector<std::string> const & names)
+		:m_names(names), m_sums(TowerIndex::nTowers * names.size()), m_cells(TowerIndex::nTowers, 0){}
+
+	void TriggerTowers::add(unsigned int cellSlot, float const * values){
+		std::pair<int, int> const & towers = TowerIndex::towers(cellSlot);
+		if (towers.first >= 0)
+			addToTower(towers.first, values);
+		if (towers.second >= 0)
+			addToTower(towers.second, values);
+	}
+
+	void TriggerTowers::addToTower(int tower, float const * values){
+		unsigned int n = m_names.size();
+		bool first = m_cells[tower] == 0;
+		for (unsigned int i = 0; i < n; ++i){
+			Sums &sums = m_sums[tower * n + i];
+			sums.sum += values[i];
+			sums.sqrSum += values[i] * values[i];
+			if (first || values[i] < sums.min)
+				sums.min = values[i];
+			if (first || values[i] > sums.max)
+				sums.max = values[i];
+		}
+		++m_cells[tower];
+	}
+
+	std::string TriggerTowers::statName(unsigned int stat){
+		switch(stat){
+			case Mean: return "Mean";
+			case Min: return "Min";
+			case Max: return "Max";
+			case Spread: return "Spread";
+			default: throw("Trying to access not existing value!");
+		}
+	}
+
+	unsigned int TriggerTowers::nTowers() const {
+		unsigned int towers = 0;
+		for (unsigned int tower = 0; tower < TowerIndex::nTowers; ++tower)
+			if (m_cells[tower] != 0)
+				++towers;
+		return towers;
+	}
+
+	unsigned int TriggerTowers::nCells(int ieta, int iphi) const {
+		int tower = TowerIndex::slot(ieta, iphi);
+		return tower < 0 ? 0 : m_cells[tower];
+	}
+
+	float TriggerTowers::value(int ieta, int iphi, unsigned int value, unsigned int stat) const {
+		int tower = TowerIndex::slot(ieta, iphi);
+		if (tower < 0 || value >= m_names.size() || stat >= nStats || m_cells[tower] == 0)
+			return std::numeric_limits<float>::quiet_NaN();
+		return this->stat(tower, value, stat);
+	}
+
+	float TriggerTowers::stat(unsigned int tower, unsigned int value, unsigned int stat) const {
+		Sums const & sums = m_sums[tower * m_names.size() + value];
+		unsigned int n = m_cells[tower];
+		double mean = sums.sum / n;
+		switch(stat){
+			case Mean: return mean;
+			case Min: return sums.min;
+			case Max: return sums.max;
+			//here needs to take absolute value for sqrt:
+			case Spread: return sqrt(fabs(sums.sqrSum / n - mean * mean));
+			default: throw("Trying to access not existing value!");
+		}
+	}
+
+	std::string TriggerTowers::summary() const {
+		std::stringstream ss;
+		unsigned int hbhe = 0, hf = 0;
+		for (unsigned int tower = 0; tower < TowerIndex::nTowers; ++tower){
+			if (m_cells[tower] == 0)
+				continue;
+			if (abs(TowerIndex::ieta(tower)) <= 28)
+				++hbhe;
+			else
+				++hf;
+		}
+		ss << "Trigger towers: " << hbhe + hf << ";    HB/HE: " << hbhe << ";    HF: " << hf << std::endl;
+
+		for (unsigned int i = 0; i < m_names.size(); ++i){
+			float minMean = 0, maxMean = 0, maxSpread = -1;
+			int spreadTower = -1;
+			for (unsigned int tower = 0; tower < TowerIndex::nTowers; ++tower){
+				if (m_cells[tower] == 0)
+					continue;
+				float mean = stat(tower, i, Mean), spread = stat(tower, i, Spread);
+				if (spreadTower < 0 || mean < minMean)
+					minMean = mean;
+				if (spreadTower < 0 || mean > maxMean)
+					maxMean = mean;
+				if (spread > maxSpread){
+					maxSpread = spread;
+					spreadTower = tower;
+				}
+			}
+			ss << "---------------------------------------------" << std::endl;
+			ss  << "    " << m_names[i] << " :" << std::endl;
+			if (spreadTower < 0)
+				continue;
+			ss	<< "          Tower means: " << minMean << " to " << maxMean << "; " << std::endl;
+			ss	<< "          Largest spread: " << maxSpread << " in tower (" << TowerIndex::ieta(spreadTower)
+				<< ", " << TowerIndex::iphi(spreadTower) << "); " << std::endl;
+		}
+		return ss.str();
+	}
+
+	std::string TriggerTowers::plot(std::string const & filename) const {
+		for (unsigned int i = 0; i < m_names.size(); ++i){
+			for (unsigned int s = 0; s < nStats; ++s){
+				std::string name = m_names[i] + " " + statName(s);
+				std::vector<TH2F> image;
+				{
+					DetachedHistograms detached;
+					image.push_back(TH2F(("_Towersrootvalue_" + m_names[i] + "_" + statName(s)).c_str(),
+						(name + " per trigger tower").c_str(),
+						2 * TowerIndex::maxIeta + 1, -TowerIndex::maxIeta - 0.5, TowerIndex::maxIeta + 0.5,
+						TowerIndex::nPhi, 0.5, TowerIndex::nPhi + 0.5));
+				}
+				TH2F & graphData = image[0];
+				graphData.SetXTitle("tower i#eta");
+				graphData.SetYTitle("tower i#phi");
+
+				for (unsigned int tower = 0; tower < TowerIndex::nTowers; ++tower)
+					if (m_cells[tower] != 0)
+						graphData.Fill(TowerIndex::ieta(tower), TowerIndex::iphi(tower), stat(tower, i, s));
+
+				std::stringstream ss;
+				ss << filename << "_" << m_names[i] << "_" << statName(s) << ".png";
+				drawImage(graphData, ss.str(), 840, 369);
+			}
+		}
+		return filename;
+	}
+}
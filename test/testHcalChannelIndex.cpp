@@ -0,0 +1,86 @@
+#include "CondFormats/HcalObjects/interface/HcalGains.h"
+#include "DataFormats/HcalDetId/interface/HcalDetId.h"
+#include "DataFormats/HcalDetId/interface/HcalCalibDetId.h"
+
+#include "CondCore/HcalPlugins/interface/HcalChannelIndex.h"
+
+#include <iostream>
+#include <vector>
+
+//ChannelIndex numbering, and ChannelIndex on a payload with channels which are not HB/HE/HO/HF cells
+using namespace HcalObjRepresent;
+
+namespace {
+	struct CountCells
+	{
+		unsigned int cells;
+		int lastSlot;
+		void operator()(int slot, HcalGain const &){
+			++cells;
+			lastSlot = slot;
+		}
+	};
+
+	int failures = 0;
+
+	void check(bool ok, char const * what){
+		if (!ok){
+			std::cerr << "FAILED: " << what << std::endl;
+			++failures;
+		}
+	}
+}
+
+int main(){
+	//detId() and slot() are inverse, valid cells get distinct slots
+	std::vector<HcalDetId> const & cells = ChannelIndex::detIds();
+	check(cells.size() == ChannelIndex::nChannels, "one cell per slot");
+	std::vector<bool> used(ChannelIndex::nChannels, false);
+	bool inverse = true, distinct = true;
+	for (unsigned int i = 0; i < cells.size(); ++i){
+		int slot = ChannelIndex::slot(cells[i]);
+		inverse = inverse && slot == (int)i;
+		if (slot >= 0 && slot < (int)ChannelIndex::nChannels){
+			distinct = distinct && !used[slot];
+			used[slot] = true;
+		}
+	}
+	check(inverse, "slot(detId(i)) == i");
+	check(distinct, "distinct slots");
+
+	//cells which validDetId rejects have no slot
+	unsigned int valid = 0;
+	HcalSubdetector subdets[4] = {HcalBarrel, HcalEndcap, HcalOuter, HcalForward};
+	for (unsigned int sd = 0; sd < 4; ++sd)
+		for (int ieta = -45; ieta <= 45; ++ieta)
+			for (int iphi = 0; iphi <= 73; ++iphi)
+				for (int depth = 0; depth <= 5; ++depth)
+					if (ChannelIndex::slot(subdets[sd], ieta, iphi, depth) >= 0)
+						++valid;
+	check(valid == ChannelIndex::nChannels, "only valid cells have slots");
+
+	HcalDetId cell(HcalBarrel, 1, 1, 1);
+	HcalCalibDetId calib(HcalBarrel, 1, 1, 0);
+
+	check(ChannelIndex::slot(DetId(cell.rawId())) >= 0, "HB cell has a slot");
+	check(ChannelIndex::slot(DetId(calib.rawId())) == -1, "calibration channel has no slot");
+	check(ChannelIndex::slot(DetId(DetId::Hcal, HcalTriggerTower)) == -1, "trigger tower has no slot");
+
+	HcalGains gains;
+	gains.addValues(HcalGain(cell.rawId(), 1.0, 1.0, 1.0, 1.0));
+	gains.addValues(HcalGain(calib.rawId(), 1.0, 1.0, 1.0, 1.0));
+
+	CountCells count = {0, -1};
+	try{
+		forEachCell(gains, count);
+	}
+	catch(...){
+		check(false, "forEachCell on payload with calibration channel");
+	}
+	check(count.cells == 1, "only the HB cell is visited");
+	check(count.lastSlot == ChannelIndex::slot(cell), "slot of the visited cell");
+
+	if (failures == 0)
+		std::cout << "testHcalChannelIndex: OK" << std::endl;
+	return failures == 0 ? 0 : 1;
+}
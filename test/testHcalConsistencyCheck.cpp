@@ -0,0 +1,51 @@
+#include "CondFormats/HcalObjects/interface/HcalGains.h"
+#include "CondFormats/HcalObjects/interface/HcalGainWidths.h"
+#include "DataFormats/HcalDetId/interface/HcalDetId.h"
+#include "DataFormats/HcalDetId/interface/HcalCalibDetId.h"
+
+#include "CondCore/HcalPlugins/interface/HcalConsistencyCheck.h"
+
+#include <iostream>
+
+//ConsistencyCheck of payloads with calibration channels, as in real QIEData and Pedestals
+using namespace HcalObjRepresent;
+
+namespace {
+	int failures = 0;
+
+	void check(bool ok, char const * what){
+		if (!ok){
+			std::cerr << "FAILED: " << what << std::endl;
+			++failures;
+		}
+	}
+}
+
+int main(){
+	HcalDetId cell(HcalBarrel, 1, 1, 1);
+	HcalCalibDetId calib(HcalBarrel, 1, 1, 0);
+
+	HcalGains gains;
+	gains.addValues(HcalGain(cell.rawId(), 1.0, 1.0, 1.0, 1.0));
+	gains.addValues(HcalGain(calib.rawId(), 1.0, 1.0, 1.0, 1.0));
+	HcalGainWidths gainWidths;
+	gainWidths.addValues(HcalGainWidth(cell.rawId(), 2.0, 0.1, 0.1, 0.1));
+	gainWidths.addValues(HcalGainWidth(calib.rawId(), 2.0, 0.1, 0.1, 0.1));
+
+	ConsistencyCheck consistency;
+	try{
+		consistency.add(gains);
+		consistency.add(gainWidths);
+		consistency.run();
+	}
+	catch(...){
+		check(false, "check of payloads with calibration channel");
+	}
+	check(consistency.count(ConsistencyCheck::GainWidthAboveGain, ConsistencyCheck::HB) == 1, "HB cell is flagged");
+	check(consistency.flagged(ConsistencyCheck::GainWidthAboveGain).size() == 1, "calibration channel is not checked");
+	check(consistency.flagged(ConsistencyCheck::MissingChannel).empty(), "no missing channels");
+
+	if (failures == 0)
+		std::cout << "testHcalConsistencyCheck: OK" << std::endl;
+	return failures == 0 ? 0 : 1;
+}